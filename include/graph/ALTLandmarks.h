@@ -0,0 +1,220 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/SearchSpace.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+
+namespace graph {
+
+enum class LandmarkSelection {
+    kFarthest,
+    kAvoid,
+};
+
+template <typename Graph, typename Weights>
+class ALTLandmarks {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    class Heuristic {
+    public:
+        Weight operator()(Vertex v) const {
+            return landmarks_->lowerBound(landmarks_->g_.index(v), t_);
+        }
+
+    private:
+        const ALTLandmarks *landmarks_;
+        size_t t_;
+
+        Heuristic(const ALTLandmarks *landmarks, size_t t) : landmarks_(landmarks), t_(t) {}
+
+        friend ALTLandmarks;
+    };
+
+    ALTLandmarks(Graph &g,
+                 Weights weights,
+                 size_t landmarkCount,
+                 LandmarkSelection selection = LandmarkSelection::kAvoid,
+                 unsigned seed = 0)
+        : g_(g),
+          weights_(g_.edgeValues(weights)),
+          search_(g_.numVertices()),
+          rng_(seed) {
+        g_.buildInEdges();
+        size_t n = g_.numVertices();
+        k_ = std::min(landmarkCount, n);
+        from_.assign(n * k_, Infinity());
+        to_.assign(n * k_, Infinity());
+        for (size_t i = 0; i < k_; ++i) {
+            size_t l = selection == LandmarkSelection::kFarthest ? selectFarthest() : selectAvoid();
+            landmarks_.push_back(l);
+            search(l, false);
+            for (size_t v = 0; v < n; ++v) {
+                if (search_.reached(v)) {
+                    from_[v * k_ + i] = search_.dist(v);
+                }
+            }
+            search(l, true);
+            for (size_t v = 0; v < n; ++v) {
+                if (search_.reached(v)) {
+                    to_[v * k_ + i] = search_.dist(v);
+                }
+            }
+        }
+    }
+
+    std::vector<Vertex> landmarks() const {
+        std::vector<Vertex> landmarks;
+        for (size_t l : landmarks_) {
+            landmarks.push_back(g_.vertex(l));
+        }
+        return landmarks;
+    }
+
+    Heuristic heuristic(Vertex t) const {
+        return Heuristic(this, g_.index(t));
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    detail::IndexedGraph<Graph> g_;
+    std::vector<Weight> weights_;
+    detail::SearchSpace<Weight> search_;
+    std::mt19937 rng_;
+    std::vector<size_t> landmarks_;
+    size_t k_{};
+    std::vector<Weight> from_;
+    std::vector<Weight> to_;
+
+    Weight lowerBound(size_t v, size_t t) const {
+        Weight h = 0;
+        const Weight *fromV = from_.data() + v * k_;
+        const Weight *fromT = from_.data() + t * k_;
+        const Weight *toV = to_.data() + v * k_;
+        const Weight *toT = to_.data() + t * k_;
+        for (size_t i = 0; i < k_; ++i) {
+            if (fromV[i] != kInfinity<Weight> && fromT[i] != kInfinity<Weight> && fromT[i] > fromV[i]) {
+                h = std::max(h, static_cast<Weight>(fromT[i] - fromV[i]));
+            }
+            if (toV[i] != kInfinity<Weight> && toT[i] != kInfinity<Weight> && toV[i] > toT[i]) {
+                h = std::max(h, static_cast<Weight>(toV[i] - toT[i]));
+            }
+        }
+        return h;
+    }
+
+    std::vector<size_t> search(size_t s, bool backward) {
+        std::vector<size_t> order;
+        search_.clear();
+        search_.relax(s, 0, kNpos);
+        while (!search_.empty()) {
+            size_t u = search_.pop();
+            order.push_back(u);
+            if (backward) {
+                for (size_t i = g_.inBegin(u); i < g_.inEnd(u); ++i) {
+                    size_t e = g_.inEdge(i);
+                    search_.relax(g_.source(e), search_.dist(u) + weights_[e], e);
+                }
+            } else {
+                for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                    search_.relax(g_.target(e), search_.dist(u) + weights_[e], e);
+                }
+            }
+        }
+        return order;
+    }
+
+    size_t selectFarthest() {
+        size_t n = g_.numVertices();
+        if (landmarks_.empty()) {
+            return search(rng_() % n, false).back();
+        }
+        size_t best = kNpos;
+        Weight bestDist = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (std::ranges::find(landmarks_, v) != landmarks_.end()) {
+                continue;
+            }
+            Weight nearest = Infinity();
+            for (size_t i = 0; i < landmarks_.size(); ++i) {
+                nearest = std::min(nearest, from_[v * k_ + i]);
+            }
+            if (nearest == Infinity()) {
+                return v;
+            }
+            if (best == kNpos || nearest > bestDist) {
+                best = v;
+                bestDist = nearest;
+            }
+        }
+        return best;
+    }
+
+    size_t selectAvoid() {
+        size_t n = g_.numVertices();
+        size_t r = rng_() % n;
+        std::vector<size_t> order = search(r, false);
+        std::vector<Weight> sizes(n, 0);
+        std::vector<bool> covered(n, false);
+        for (size_t l : landmarks_) {
+            covered[l] = true;
+        }
+        for (size_t v : order) {
+            Weight bound = lowerBound(r, v);
+            sizes[v] = search_.dist(v) > bound ? search_.dist(v) - bound : 0;
+        }
+        for (size_t i = order.size(); i-- > 1;) {
+            size_t v = order[i];
+            size_t parent = g_.source(search_.pred(v));
+            if (covered[v]) {
+                sizes[v] = 0;
+                covered[parent] = true;
+            }
+            if (!covered[parent]) {
+                sizes[parent] += sizes[v];
+            }
+        }
+        std::vector<size_t> offsets(n + 1, 0);
+        for (size_t i = 1; i < order.size(); ++i) {
+            ++offsets[g_.source(search_.pred(order[i])) + 1];
+        }
+        for (size_t v = 0; v < n; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<size_t> children(order.size());
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 1; i < order.size(); ++i) {
+            size_t v = order[i];
+            children[next[g_.source(search_.pred(v))]++] = v;
+        }
+        size_t v = r;
+        while (offsets[v] < offsets[v + 1]) {
+            size_t best = children[offsets[v]];
+            for (size_t i = offsets[v] + 1; i < offsets[v + 1]; ++i) {
+                if (sizes[children[i]] > sizes[best]) {
+                    best = children[i];
+                }
+            }
+            if (sizes[best] == 0 && !landmarks_.empty()) {
+                break;
+            }
+            v = best;
+        }
+        if (std::ranges::find(landmarks_, v) != landmarks_.end()) {
+            return selectFarthest();
+        }
+        return v;
+    }
+};
+
+} // namespace graph
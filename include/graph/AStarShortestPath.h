@@ -0,0 +1,88 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+#include "graph/SetPriorityQueue.h"
+
+namespace graph {
+
+template <typename Graph,
+          typename Weights,
+          typename Heuristic,
+          typename Dists,
+          typename Preds,
+          typename PriorityQueue = SetPriorityQueue<typename Graph::Vertex,
+                                                    typename GeneralizedMapTraits<Weights>::Value>>
+class AStarShortestPath {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    AStarShortestPath(Graph &g,
+                      Vertex s,
+                      Vertex t,
+                      Weights weights,
+                      Heuristic heuristic,
+                      Dists dists,
+                      Preds preds,
+                      PriorityQueue queue = {})
+        : g_(g),
+          s_(s),
+          t_(t),
+          weights_(std::move(weights)),
+          heuristic_(std::move(heuristic)),
+          dists_(std::move(dists)),
+          preds_(std::move(preds)),
+          queue_(std::move(queue)) {}
+
+    bool operator()() {
+        for (Vertex v : g_.vertices()) {
+            put(dists_, v, Infinity());
+            put(preds_, v, std::nullopt);
+        }
+        put(dists_, s_, 0);
+        put(preds_, s_, std::nullopt);
+        queue_.push(s_, heuristic_(s_));
+        while (!queue_.empty()) {
+            auto [key, u] = queue_.pop();
+            if (get(dists_, u) + heuristic_(u) < key) {
+                continue;
+            }
+            if (u == t_) {
+                return true;
+            }
+            for (Edge e : g_.outEdges(u)) {
+                Vertex v = g_.target(e);
+                Weight w = get(weights_, e);
+                if (get(dists_, v) > get(dists_, u) + w) {
+                    Weight old = get(dists_, v);
+                    Weight h = heuristic_(v);
+                    put(dists_, v, get(dists_, u) + w);
+                    put(preds_, v, u);
+                    if (old == Infinity()) {
+                        queue_.push(v, get(dists_, v) + h);
+                    } else {
+                        queue_.decrease(v, old + h, get(dists_, v) + h);
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    Graph &g_;
+    Vertex s_;
+    Vertex t_;
+    Weights weights_;
+    Heuristic heuristic_;
+    Dists dists_;
+    Preds preds_;
+    PriorityQueue queue_;
+};
+
+} // namespace graph
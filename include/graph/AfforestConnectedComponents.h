@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/atomic.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename RepresentativeVertices>
+class AfforestConnectedComponents {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    AfforestConnectedComponents(Graph &g,
+                                RepresentativeVertices representativeVertices,
+                                size_t neighborRounds = 2,
+                                size_t sampleCount = 1024)
+        : g_(g),
+          representativeVertices_(std::move(representativeVertices)),
+          neighborRounds_(neighborRounds),
+          sampleCount_(sampleCount) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        std::vector<size_t> C(n);
+        std::iota(C.begin(), C.end(), 0);
+
+        for (size_t r = 0; r < neighborRounds_; ++r) {
+            detail::parallelFor(0, n, [&](size_t u) {
+                if (r < G.outDegree(u)) {
+                    link(C, u, G.target(G.outBegin(u) + r));
+                }
+            });
+            compress(C);
+        }
+
+        size_t giant = sampleFrequentComponent(C);
+        if (giant == kNpos) {
+            shiloachVishkin(G, C);
+        } else {
+            G.buildInEdges();
+            detail::parallelFor(0, n, [&](size_t u) {
+                if (detail::atomicLoad(C[u]) == giant) {
+                    return;
+                }
+                for (size_t e = G.outBegin(u) + std::min(neighborRounds_, G.outDegree(u)); e < G.outEnd(u); ++e) {
+                    link(C, u, G.target(e));
+                }
+                for (size_t i = G.inBegin(u); i < G.inEnd(u); ++i) {
+                    link(C, u, G.source(G.inEdge(i)));
+                }
+            }, 64);
+            compress(C);
+        }
+
+        size_t componentCount = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (C[v] == v) {
+                ++componentCount;
+            }
+            put(representativeVertices_, G.vertex(v), G.vertex(C[v]));
+        }
+        return componentCount;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+    static constexpr size_t kGiantFraction = 10;
+
+    Graph &g_;
+    RepresentativeVertices representativeVertices_;
+    size_t neighborRounds_;
+    size_t sampleCount_;
+
+    static void link(std::vector<size_t> &C, size_t u, size_t v) {
+        size_t p1 = detail::atomicLoad(C[u]);
+        size_t p2 = detail::atomicLoad(C[v]);
+        while (p1 != p2) {
+            size_t high = std::max(p1, p2);
+            size_t low = std::min(p1, p2);
+            size_t pHigh = detail::atomicLoad(C[high]);
+            if (pHigh == low) {
+                break;
+            }
+            if (pHigh == high && std::atomic_ref<size_t>(C[high]).compare_exchange_strong(
+                                     pHigh, low, std::memory_order_relaxed)) {
+                break;
+            }
+            p1 = detail::atomicLoad(C[detail::atomicLoad(C[high])]);
+            p2 = detail::atomicLoad(C[low]);
+        }
+    }
+
+    static void compress(std::vector<size_t> &C) {
+        detail::parallelFor(0, C.size(), [&](size_t v) {
+            while (true) {
+                size_t p = detail::atomicLoad(C[v]);
+                size_t gp = detail::atomicLoad(C[p]);
+                if (p == gp) {
+                    break;
+                }
+                detail::atomicStore(C[v], gp);
+            }
+        });
+    }
+
+    size_t sampleFrequentComponent(const std::vector<size_t> &C) const {
+        if (C.empty() || sampleCount_ == 0) {
+            return kNpos;
+        }
+        std::mt19937_64 rng(C.size());
+        std::uniform_int_distribution<size_t> dist(0, C.size() - 1);
+        std::unordered_map<size_t, size_t> counts;
+        for (size_t i = 0; i < sampleCount_; ++i) {
+            ++counts[C[dist(rng)]];
+        }
+        auto [c, count] = *std::ranges::max_element(counts, {}, [](const auto &p) {
+            return p.second;
+        });
+        return count * kGiantFraction >= sampleCount_ ? c : kNpos;
+    }
+
+    static void shiloachVishkin(const detail::IndexedGraph<Graph> &G, std::vector<size_t> &C) {
+        std::atomic<bool> changed = true;
+        while (changed.load(std::memory_order_relaxed)) {
+            changed.store(false, std::memory_order_relaxed);
+            detail::parallelFor(0, G.numEdges(), [&](size_t e) {
+                size_t cu = detail::atomicLoad(C[G.source(e)]);
+                size_t cv = detail::atomicLoad(C[G.target(e)]);
+                if (cu == cv) {
+                    return;
+                }
+                size_t high = std::max(cu, cv);
+                size_t low = std::min(cu, cv);
+                if (std::atomic_ref<size_t>(C[high]).compare_exchange_strong(high, low, std::memory_order_relaxed)) {
+                    changed.store(true, std::memory_order_relaxed);
+                }
+            });
+            compress(C);
+        }
+    }
+};
+
+} // namespace graph
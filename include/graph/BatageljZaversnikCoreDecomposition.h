@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename CoreNumbers>
+class BatageljZaversnikCoreDecomposition {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    BatageljZaversnikCoreDecomposition(Graph &g, CoreNumbers coreNumbers)
+        : g_(g), coreNumbers_(std::move(coreNumbers)) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        std::vector<size_t> degrees(n);
+        size_t maxDegree = 0;
+        for (size_t v = 0; v < n; ++v) {
+            for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                degrees[v] += G.target(e) != v;
+            }
+            maxDegree = std::max(maxDegree, degrees[v]);
+        }
+
+        std::vector<size_t> bins(maxDegree + 1);
+        for (size_t v = 0; v < n; ++v) {
+            ++bins[degrees[v]];
+        }
+        size_t start = 0;
+        for (size_t &bin : bins) {
+            size_t count = bin;
+            bin = start;
+            start += count;
+        }
+        std::vector<size_t> positions(n);
+        std::vector<size_t> order(n);
+        for (size_t v = 0; v < n; ++v) {
+            positions[v] = bins[degrees[v]]++;
+            order[positions[v]] = v;
+        }
+        for (size_t d = maxDegree; d > 0; --d) {
+            bins[d] = bins[d - 1];
+        }
+        if (!bins.empty()) {
+            bins[0] = 0;
+        }
+
+        size_t degeneracy = 0;
+        for (size_t i = 0; i < n; ++i) {
+            size_t v = order[i];
+            degeneracy = std::max(degeneracy, degrees[v]);
+            for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                size_t u = G.target(e);
+                if (degrees[u] > degrees[v]) {
+                    size_t du = degrees[u];
+                    size_t pu = positions[u];
+                    size_t pw = bins[du];
+                    size_t w = order[pw];
+                    if (u != w) {
+                        positions[u] = pw;
+                        positions[w] = pu;
+                        order[pu] = w;
+                        order[pw] = u;
+                    }
+                    ++bins[du];
+                    --degrees[u];
+                }
+            }
+        }
+
+        for (size_t v = 0; v < n; ++v) {
+            put(coreNumbers_, G.vertex(v), degrees[v]);
+        }
+        return degeneracy;
+    }
+
+private:
+    Graph &g_;
+    CoreNumbers coreNumbers_;
+};
+
+} // namespace graph
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <queue>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "graph/GeneralizedMaps.h"
 #include "graph/Infinity.h"
@@ -26,7 +29,7 @@ public:
           dists_(std::move(dists)),
           preds_(std::move(preds)) {}
 
-    void operator()() {
+    std::vector<Vertex> operator()() {
         for (Vertex v : g_.vertices()) {
             put(dists_, v, Infinity());
             put(preds_, v, std::nullopt);
@@ -36,10 +39,13 @@ public:
         std::queue<Vertex> Q;
         Q.push(s_);
         VertexMap<bool> S;
+        VertexMap<size_t> L;
         for (Vertex v : g_.vertices()) {
             put(S, v, false);
+            put(L, v, 0);
         }
         put(S, s_, true);
+        size_t n = g_.numVertices();
         while (!Q.empty()) {
             Vertex u = Q.front();
             Q.pop();
@@ -50,6 +56,13 @@ public:
                 if (get(dists_, v) > get(dists_, u) + w) {
                     put(dists_, v, get(dists_, u) + w);
                     put(preds_, v, u);
+                    put(L, v, get(L, u) + 1);
+                    if (get(L, v) >= n) {
+                        std::vector<Vertex> cycle = findCycle(v);
+                        if (!cycle.empty()) {
+                            return cycle;
+                        }
+                    }
                     if (!get(S, v)) {
                         Q.push(v);
                         put(S, v, true);
@@ -57,6 +70,7 @@ public:
                 }
             }
         }
+        return {};
     }
 
 private:
@@ -65,6 +79,29 @@ private:
     Weights weights_;
     Dists dists_;
     Preds preds_;
+
+    std::vector<Vertex> findCycle(Vertex v) {
+        VertexMap<bool> visited;
+        for (Vertex w : g_.vertices()) {
+            put(visited, w, false);
+        }
+        std::optional<Vertex> u = v;
+        while (u.has_value() && !get(visited, *u)) {
+            put(visited, *u, true);
+            u = get(preds_, *u);
+        }
+        if (!u.has_value()) {
+            return {};
+        }
+        std::vector<Vertex> cycle;
+        Vertex x = *u;
+        do {
+            cycle.push_back(x);
+            x = *get(preds_, x);
+        } while (x != *u);
+        std::ranges::reverse(cycle);
+        return cycle;
+    }
 };
 
 } // namespace graph
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/SearchSpace.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class BidirectionalDijkstraShortestPath {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    BidirectionalDijkstraShortestPath(Graph &g, Weights weights)
+        : g_(g),
+          weights_(g_.edgeValues(weights)),
+          forward_(g_.numVertices()),
+          backward_(g_.numVertices()) {
+        g_.buildInEdges();
+    }
+
+    std::optional<std::pair<Weight, std::vector<Edge>>> operator()(Vertex s, Vertex t) {
+        size_t si = g_.index(s);
+        size_t ti = g_.index(t);
+        if (si == ti) {
+            return std::pair<Weight, std::vector<Edge>>{0, {}};
+        }
+        forward_.clear();
+        backward_.clear();
+        forward_.relax(si, 0, kNpos);
+        backward_.relax(ti, 0, kNpos);
+        std::optional<Weight> best;
+        size_t meet = kNpos;
+        while (!forward_.empty() && !backward_.empty()) {
+            if (best.has_value() && forward_.topKey() + backward_.topKey() >= *best) {
+                break;
+            }
+            if (forward_.topKey() <= backward_.topKey()) {
+                size_t u = forward_.pop();
+                for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                    size_t v = g_.target(e);
+                    if (forward_.relax(v, forward_.dist(u) + weights_[e], e) && backward_.reached(v)) {
+                        Weight d = forward_.dist(v) + backward_.dist(v);
+                        if (!best.has_value() || d < *best) {
+                            best = d;
+                            meet = v;
+                        }
+                    }
+                }
+            } else {
+                size_t u = backward_.pop();
+                for (size_t i = g_.inBegin(u); i < g_.inEnd(u); ++i) {
+                    size_t e = g_.inEdge(i);
+                    size_t v = g_.source(e);
+                    if (backward_.relax(v, backward_.dist(u) + weights_[e], e) && forward_.reached(v)) {
+                        Weight d = forward_.dist(v) + backward_.dist(v);
+                        if (!best.has_value() || d < *best) {
+                            best = d;
+                            meet = v;
+                        }
+                    }
+                }
+            }
+        }
+        if (!best.has_value()) {
+            return std::nullopt;
+        }
+        std::vector<Edge> path;
+        for (size_t v = meet; v != si; v = g_.source(forward_.pred(v))) {
+            path.push_back(g_.edge(forward_.pred(v)));
+        }
+        std::ranges::reverse(path);
+        for (size_t v = meet; v != ti; v = g_.target(backward_.pred(v))) {
+            path.push_back(g_.edge(backward_.pred(v)));
+        }
+        return std::pair<Weight, std::vector<Edge>>{*best, std::move(path)};
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    detail::IndexedGraph<Graph> g_;
+    std::vector<Weight> weights_;
+    detail::SearchSpace<Weight> forward_;
+    detail::SearchSpace<Weight> backward_;
+};
+
+} // namespace graph
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "graph/GeneralizedMaps.h"
+#include "graph/TarjanBiconnectedComponents.h"
+
+namespace graph {
+
+template <typename Graph>
+class BlockCutTree {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+    template <typename V>
+    using VertexMap = Graph::template VertexMap<V>;
+
+    template <typename V>
+    using EdgeMap = Graph::template EdgeMap<V>;
+
+public:
+    static constexpr size_t kNpos = -1;
+
+    explicit BlockCutTree(Graph &g) {
+        blockVertices_.resize(TarjanBiconnectedComponents(g, &blockNumbers_)());
+        std::vector<size_t> blocks;
+        for (Vertex u : g.vertices()) {
+            blocks.clear();
+            for (Edge e : g.outEdges(u)) {
+                if (get(blockNumbers_, e) != kNpos) {
+                    blocks.push_back(get(blockNumbers_, e));
+                }
+            }
+            std::ranges::sort(blocks);
+            blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+            for (size_t b : blocks) {
+                blockVertices_[b].push_back(u);
+            }
+            if (blocks.size() > 1) {
+                cutVertices_.push_back(u);
+            }
+            put(blocks_, u, blocks);
+        }
+    }
+
+    size_t numBlocks() const {
+        return blockVertices_.size();
+    }
+
+    size_t block(Edge e) const {
+        return get(blockNumbers_, e);
+    }
+
+    const std::vector<Vertex> &blockVertices(size_t b) const {
+        return blockVertices_[b];
+    }
+
+    const std::vector<size_t> &blocks(Vertex v) const {
+        return get(blocks_, v);
+    }
+
+    bool isCutVertex(Vertex v) const {
+        return get(blocks_, v).size() > 1;
+    }
+
+    const std::vector<Vertex> &cutVertices() const {
+        return cutVertices_;
+    }
+
+private:
+    EdgeMap<size_t> blockNumbers_;
+    VertexMap<std::vector<size_t>> blocks_;
+    std::vector<std::vector<Vertex>> blockVertices_;
+    std::vector<Vertex> cutVertices_;
+};
+
+} // namespace graph
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/ConcurrentDisjointSets.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights, typename MstEdges>
+class BoruvkaMinimumSpanningTree {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    BoruvkaMinimumSpanningTree(Graph &g, Weights weights, MstEdges mstEdges)
+        : g_(g), weights_(std::move(weights)), mstEdges_(std::move(mstEdges)) {}
+
+    void operator()() {
+        detail::IndexedGraph<Graph> g(g_);
+        std::vector<Weight> weights = g.edgeValues(weights_);
+        size_t n = g.numVertices();
+        size_t m = g.numEdges();
+
+        auto key = [&](size_t e) {
+            size_t u = g.source(e);
+            size_t v = g.target(e);
+            return u < v ? std::pair(u, v) : std::pair(v, u);
+        };
+
+        auto less = [&](size_t lhs, size_t rhs) {
+            if (weights[lhs] != weights[rhs]) {
+                return weights[lhs] < weights[rhs];
+            }
+            return key(lhs) < key(rhs);
+        };
+
+        auto offer = [&](size_t &best, size_t e) {
+            std::atomic_ref<size_t> ref(best);
+            size_t current = ref.load(std::memory_order_relaxed);
+            while (current == kNpos || less(e, current)) {
+                if (ref.compare_exchange_weak(current, e, std::memory_order_relaxed)) {
+                    return;
+                }
+            }
+        };
+
+        detail::ConcurrentDisjointSets D(n);
+        std::vector<size_t> best(n, kNpos);
+        std::vector<char> chosen(m, false);
+        std::vector<size_t> edges;
+        edges.reserve(m);
+        for (size_t e = 0; e < m; ++e) {
+            if (g.source(e) != g.target(e)) {
+                edges.push_back(e);
+            }
+        }
+        std::vector<std::vector<size_t>> kept(detail::threadCount());
+        std::vector<size_t> roots;
+
+        while (!edges.empty()) {
+            for (std::vector<size_t> &k : kept) {
+                k.clear();
+            }
+            detail::parallelFor(0, edges.size(), [&](size_t thread, size_t i) {
+                size_t e = edges[i];
+                size_t cu = D.find(g.source(e));
+                size_t cv = D.find(g.target(e));
+                if (cu != cv) {
+                    offer(best[cu], e);
+                    offer(best[cv], e);
+                    kept[thread].push_back(e);
+                }
+            });
+            edges.clear();
+            for (std::vector<size_t> &k : kept) {
+                edges.insert(edges.end(), k.begin(), k.end());
+            }
+            if (edges.empty()) {
+                break;
+            }
+
+            roots.clear();
+            for (size_t v = 0; v < n; ++v) {
+                if (best[v] != kNpos) {
+                    roots.push_back(v);
+                }
+            }
+            detail::parallelFor(0, roots.size(), [&](size_t i) {
+                size_t e = best[roots[i]];
+                if (D.union_(g.source(e), g.target(e))) {
+                    chosen[e] = true;
+                }
+            });
+            detail::parallelFor(0, roots.size(), [&](size_t i) {
+                best[roots[i]] = kNpos;
+            });
+        }
+
+        for (size_t e = 0; e < m; ++e) {
+            put(mstEdges_, g.edge(e), static_cast<bool>(chosen[e]));
+        }
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    Graph &g_;
+    Weights weights_;
+    MstEdges mstEdges_;
+};
+
+} // namespace graph
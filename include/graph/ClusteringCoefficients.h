@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/TriangleCounts.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Coefficients>
+class ClusteringCoefficients {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Coefficient = GeneralizedMapTraits<Coefficients>::Value;
+
+public:
+    ClusteringCoefficients(Graph &g, Coefficients coefficients) : g_(g), coefficients_(std::move(coefficients)) {}
+
+    Coefficient operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        if (n == 0) {
+            return 0;
+        }
+        detail::TriangleCounts T(G);
+        Coefficient sum = 0;
+        for (size_t v = 0; v < n; ++v) {
+            size_t degree = T.degree(v);
+            Coefficient c = 0;
+            if (degree >= 2) {
+                c = static_cast<Coefficient>(2 * T.triangles(v)) / static_cast<Coefficient>(degree * (degree - 1));
+            }
+            put(coefficients_, G.vertex(v), c);
+            sum += c;
+        }
+        return sum / static_cast<Coefficient>(n);
+    }
+
+private:
+    Graph &g_;
+    Coefficients coefficients_;
+};
+
+} // namespace graph
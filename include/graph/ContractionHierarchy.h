@@ -0,0 +1,486 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/binary.h"
+#include "graph/detail/hash.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/SearchSpace.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class ContractionHierarchy {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    ContractionHierarchy(Graph &g, Weights weights, size_t witnessLimit = 500)
+        : g_(g), forward_(g_.numVertices()), backward_(g_.numVertices()) {
+        std::vector<Weight> W = g_.edgeValues(weights);
+        digest_ = digest(W);
+        build(std::move(W), witnessLimit);
+    }
+
+    static ContractionHierarchy load(Graph &g, Weights weights, std::istream &in) {
+        ContractionHierarchy ch(g);
+        ch.digest_ = ch.digest(ch.g_.edgeValues(weights));
+        uint64_t magic = 0;
+        uint64_t n = 0;
+        uint64_t m = 0;
+        detail::readBinary(in, magic);
+        detail::readBinary(in, n);
+        detail::readBinary(in, m);
+        if (!in || magic != kMagic || n != ch.g_.numVertices() || m != ch.g_.numEdges()) {
+            throw std::runtime_error("ContractionHierarchy: incompatible input");
+        }
+        uint64_t digest = 0;
+        detail::readBinary(in, digest);
+        if (!in || digest != ch.digest_) {
+            throw std::runtime_error("ContractionHierarchy: input was built for a different graph or weights");
+        }
+        detail::readBinary(in, ch.ranks_);
+        uint64_t arcCount = 0;
+        detail::readBinary(in, arcCount);
+        for (uint64_t i = 0; i < arcCount && in; ++i) {
+            ch.arcs_.push_back(readArc(in));
+        }
+        detail::readBinary(in, ch.upOffsets_);
+        detail::readBinary(in, ch.upArcs_);
+        detail::readBinary(in, ch.downOffsets_);
+        detail::readBinary(in, ch.downArcs_);
+        if (!in) {
+            throw std::runtime_error("ContractionHierarchy: truncated input");
+        }
+        if (!ch.valid()) {
+            throw std::runtime_error("ContractionHierarchy: corrupt input");
+        }
+        return ch;
+    }
+
+    void save(std::ostream &out) const {
+        detail::writeBinary(out, kMagic);
+        detail::writeBinary(out, static_cast<uint64_t>(g_.numVertices()));
+        detail::writeBinary(out, static_cast<uint64_t>(g_.numEdges()));
+        detail::writeBinary(out, digest_);
+        detail::writeBinary(out, ranks_);
+        detail::writeBinary(out, static_cast<uint64_t>(arcs_.size()));
+        for (const Arc &arc : arcs_) {
+            detail::writeBinary(out, static_cast<uint64_t>(arc.source));
+            detail::writeBinary(out, static_cast<uint64_t>(arc.target));
+            detail::writeBinary(out, arc.weight);
+            detail::writeBinary(out, static_cast<uint64_t>(arc.first));
+            detail::writeBinary(out, static_cast<uint64_t>(arc.second));
+        }
+        detail::writeBinary(out, upOffsets_);
+        detail::writeBinary(out, upArcs_);
+        detail::writeBinary(out, downOffsets_);
+        detail::writeBinary(out, downArcs_);
+    }
+
+    size_t rank(Vertex v) const {
+        return ranks_[g_.index(v)];
+    }
+
+    size_t numShortcuts() const {
+        size_t count = 0;
+        for (const Arc &arc : arcs_) {
+            if (arc.second != kNpos) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    std::optional<std::pair<Weight, std::vector<Edge>>> operator()(Vertex s, Vertex t) {
+        size_t si = g_.index(s);
+        size_t ti = g_.index(t);
+        if (si == ti) {
+            return std::pair<Weight, std::vector<Edge>>{0, {}};
+        }
+        forward_.clear();
+        backward_.clear();
+        forward_.relax(si, 0, kNpos);
+        backward_.relax(ti, 0, kNpos);
+        std::optional<Weight> best;
+        size_t meet = kNpos;
+        while (true) {
+            bool forwardDone = forward_.empty() || (best.has_value() && forward_.topKey() >= *best);
+            bool backwardDone = backward_.empty() || (best.has_value() && backward_.topKey() >= *best);
+            if (forwardDone && backwardDone) {
+                break;
+            }
+            bool forward = backwardDone || (!forwardDone && forward_.topKey() <= backward_.topKey());
+            auto &search = forward ? forward_ : backward_;
+            auto &other = forward ? backward_ : forward_;
+            size_t u = search.pop();
+            if (other.reached(u)) {
+                Weight d = search.dist(u) + other.dist(u);
+                if (!best.has_value() || d < *best) {
+                    best = d;
+                    meet = u;
+                }
+            }
+            const auto &stallOffsets = forward ? downOffsets_ : upOffsets_;
+            const auto &stallArcs = forward ? downArcs_ : upArcs_;
+            bool stalled = false;
+            for (size_t i = stallOffsets[u]; i < stallOffsets[u + 1]; ++i) {
+                const Arc &arc = arcs_[stallArcs[i]];
+                size_t x = forward ? arc.source : arc.target;
+                if (search.reached(x) && search.dist(x) + arc.weight < search.dist(u)) {
+                    stalled = true;
+                    break;
+                }
+            }
+            if (stalled) {
+                continue;
+            }
+            const auto &offsets = forward ? upOffsets_ : downOffsets_;
+            const auto &arcIds = forward ? upArcs_ : downArcs_;
+            for (size_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+                const Arc &arc = arcs_[arcIds[i]];
+                size_t x = forward ? arc.target : arc.source;
+                search.relax(x, search.dist(u) + arc.weight, arcIds[i]);
+            }
+        }
+        if (!best.has_value()) {
+            return std::nullopt;
+        }
+        std::vector<size_t> up;
+        for (size_t v = meet; v != si; v = arcs_[forward_.pred(v)].source) {
+            up.push_back(forward_.pred(v));
+        }
+        std::ranges::reverse(up);
+        for (size_t v = meet; v != ti; v = arcs_[backward_.pred(v)].target) {
+            up.push_back(backward_.pred(v));
+        }
+        std::vector<Edge> path;
+        for (size_t a : up) {
+            unpack(a, path);
+        }
+        return std::pair<Weight, std::vector<Edge>>{*best, std::move(path)};
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+    static constexpr uint64_t kMagic = 0x3348434870617267;
+
+    struct Arc {
+        size_t source;
+        size_t target;
+        Weight weight;
+        size_t first;
+        size_t second;
+    };
+
+    detail::IndexedGraph<Graph> g_;
+    uint64_t digest_ = 0;
+    std::vector<size_t> ranks_;
+    std::vector<Arc> arcs_;
+    std::vector<size_t> upOffsets_;
+    std::vector<size_t> upArcs_;
+    std::vector<size_t> downOffsets_;
+    std::vector<size_t> downArcs_;
+    detail::SearchSpace<Weight> forward_;
+    detail::SearchSpace<Weight> backward_;
+
+    explicit ContractionHierarchy(Graph &g)
+        : g_(g), forward_(g_.numVertices()), backward_(g_.numVertices()) {}
+
+    uint64_t digest(const std::vector<Weight> &weights) const {
+        uint64_t h = mix(mix(0, g_.numVertices()), g_.numEdges());
+        for (size_t v = 0; v < g_.numVertices(); ++v) {
+            h = mix(h, detail::hashValue(g_.vertex(v)));
+        }
+        for (size_t e = 0; e < g_.numEdges(); ++e) {
+            h = mix(mix(mix(h, g_.source(e)), g_.target(e)), detail::hashValue(weights[e]));
+        }
+        return h;
+    }
+
+    static uint64_t mix(uint64_t h, uint64_t value) {
+        value *= 0x9e3779b97f4a7c15;
+        value ^= value >> 32;
+        return (h ^ value) * 0xff51afd7ed558ccd + (h >> 29);
+    }
+
+    static Arc readArc(std::istream &in) {
+        uint64_t source = 0;
+        uint64_t target = 0;
+        Weight weight{};
+        uint64_t first = 0;
+        uint64_t second = 0;
+        detail::readBinary(in, source);
+        detail::readBinary(in, target);
+        detail::readBinary(in, weight);
+        detail::readBinary(in, first);
+        detail::readBinary(in, second);
+        return {static_cast<size_t>(source), static_cast<size_t>(target), weight, static_cast<size_t>(first),
+                static_cast<size_t>(second)};
+    }
+
+    bool valid() const {
+        size_t n = g_.numVertices();
+        if (ranks_.size() != n) {
+            return false;
+        }
+        std::vector<uint8_t> seen(n, false);
+        for (size_t r : ranks_) {
+            if (r >= n || seen[r]) {
+                return false;
+            }
+            seen[r] = true;
+        }
+        for (size_t a = 0; a < arcs_.size(); ++a) {
+            const Arc &arc = arcs_[a];
+            if (arc.source >= n || arc.target >= n) {
+                return false;
+            }
+            if (arc.second == kNpos ? arc.first >= g_.numEdges() : arc.first >= a || arc.second >= a) {
+                return false;
+            }
+        }
+        auto validIndex = [&](const std::vector<size_t> &offsets, const std::vector<size_t> &arcIds, bool up) {
+            if (offsets.size() != n + 1 || offsets.front() != 0 || offsets.back() != arcIds.size()) {
+                return false;
+            }
+            for (size_t v = 0; v < n; ++v) {
+                if (offsets[v] > offsets[v + 1]) {
+                    return false;
+                }
+                for (size_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+                    if (arcIds[i] >= arcs_.size() || (up ? arcs_[arcIds[i]].source : arcs_[arcIds[i]].target) != v) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        };
+        return validIndex(upOffsets_, upArcs_, true) && validIndex(downOffsets_, downArcs_, false);
+    }
+
+    void unpack(size_t a, std::vector<Edge> &path) const {
+        std::vector<size_t> stack{a};
+        while (!stack.empty()) {
+            const Arc &arc = arcs_[stack.back()];
+            stack.pop_back();
+            if (arc.second == kNpos) {
+                path.push_back(g_.edge(arc.first));
+            } else {
+                stack.push_back(arc.second);
+                stack.push_back(arc.first);
+            }
+        }
+    }
+
+    class Contraction {
+    public:
+        Contraction(ContractionHierarchy &ch, size_t n, size_t witnessLimit)
+            : ch_(ch), out_(n), in_(n), contracted_(n, false), deleted_(n, 0), witnessLimit_(witnessLimit) {}
+
+        void addArc(size_t u, size_t w, Weight weight, size_t first, size_t second) {
+            for (auto &[x, a] : out_[u]) {
+                if (x == w) {
+                    if (weight < ch_.arcs_[a].weight) {
+                        size_t b = ch_.arcs_.size();
+                        ch_.arcs_.push_back({u, w, weight, first, second});
+                        for (auto &[y, c] : in_[w]) {
+                            if (y == u) {
+                                c = b;
+                            }
+                        }
+                        a = b;
+                    }
+                    return;
+                }
+            }
+            size_t b = ch_.arcs_.size();
+            ch_.arcs_.push_back({u, w, weight, first, second});
+            out_[u].push_back({w, b});
+            in_[w].push_back({u, b});
+        }
+
+        template <typename F>
+        size_t simulate(size_t v, const std::vector<uint8_t> &excluded, detail::SearchSpace<Weight> &search, F &&emit) const {
+            size_t shortcuts = 0;
+            for (auto [u, a1] : in_[v]) {
+                Weight wu = ch_.arcs_[a1].weight;
+                Weight limit = 0;
+                size_t targets = 0;
+                for (auto [w, a2] : out_[v]) {
+                    if (w != u) {
+                        limit = std::max(limit, static_cast<Weight>(wu + ch_.arcs_[a2].weight));
+                        ++targets;
+                    }
+                }
+                if (targets == 0) {
+                    continue;
+                }
+                search.clear();
+                search.relax(u, 0, kNpos);
+                size_t settled = 0;
+                while (!search.empty() && !(limit < search.topKey()) && settled < witnessLimit_) {
+                    size_t x = search.pop();
+                    ++settled;
+                    if (x != u && std::ranges::find(out_[v], x, &std::pair<size_t, size_t>::first) != out_[v].end() &&
+                        --targets == 0) {
+                        break;
+                    }
+                    for (auto [y, a] : out_[x]) {
+                        if (y != v && !excluded[y]) {
+                            search.relax(y, search.dist(x) + ch_.arcs_[a].weight, kNpos);
+                        }
+                    }
+                }
+                for (auto [w, a2] : out_[v]) {
+                    if (w == u) {
+                        continue;
+                    }
+                    Weight through = wu + ch_.arcs_[a2].weight;
+                    if (!search.reached(w) || through < search.dist(w)) {
+                        ++shortcuts;
+                        emit(u, w, through, a1, a2);
+                    }
+                }
+            }
+            return shortcuts;
+        }
+
+        long long priority(size_t v, detail::SearchSpace<Weight> &search) const {
+            size_t shortcuts = simulate(v, contracted_, search, [](size_t, size_t, Weight, size_t, size_t) {});
+            return static_cast<long long>(shortcuts) - static_cast<long long>(in_[v].size() + out_[v].size()) +
+                   static_cast<long long>(deleted_[v]);
+        }
+
+        void run() {
+            size_t n = out_.size();
+            std::vector<detail::SearchSpace<Weight>> searches(detail::threadCount(),
+                                                              detail::SearchSpace<Weight>(n));
+            std::vector<long long> priorities(n);
+            std::vector<size_t> remaining(n);
+            for (size_t v = 0; v < n; ++v) {
+                remaining[v] = v;
+            }
+            detail::parallelFor(0, n, [&](size_t thread, size_t v) {
+                priorities[v] = priority(v, searches[thread]);
+            }, 64);
+            auto before = [&](size_t v, size_t x) {
+                return priorities[v] < priorities[x] || (priorities[v] == priorities[x] && v < x);
+            };
+            std::vector<std::vector<std::tuple<size_t, size_t, Weight, size_t, size_t>>> shortcuts(n);
+            std::vector<uint8_t> selected(n, false);
+            std::vector<size_t> independent;
+            std::vector<size_t> touched;
+            std::vector<uint8_t> dirty(n, false);
+            ch_.ranks_.assign(n, 0);
+            std::vector<std::vector<size_t>> up(n);
+            std::vector<std::vector<size_t>> down(n);
+            size_t rank = 0;
+            while (!remaining.empty()) {
+                detail::parallelFor(0, remaining.size(), [&](size_t i) {
+                    size_t v = remaining[i];
+                    bool minimal = true;
+                    for (auto [x, a] : out_[v]) {
+                        minimal = minimal && before(v, x);
+                    }
+                    for (auto [x, a] : in_[v]) {
+                        minimal = minimal && before(v, x);
+                    }
+                    selected[v] = minimal;
+                });
+                independent.clear();
+                for (size_t v : remaining) {
+                    if (selected[v]) {
+                        independent.push_back(v);
+                    }
+                }
+                detail::parallelFor(0, independent.size(), [&](size_t thread, size_t i) {
+                    size_t v = independent[i];
+                    simulate(v, selected, searches[thread], [&](size_t u, size_t w, Weight weight, size_t a1, size_t a2) {
+                        shortcuts[v].push_back({u, w, weight, a1, a2});
+                    });
+                }, 4);
+                touched.clear();
+                for (size_t v : independent) {
+                    ch_.ranks_[v] = rank++;
+                    contracted_[v] = true;
+                    for (auto [w, a] : out_[v]) {
+                        up[v].push_back(a);
+                        std::erase_if(in_[w], [v](const auto &entry) { return entry.first == v; });
+                        ++deleted_[w];
+                        touched.push_back(w);
+                    }
+                    for (auto [u, a] : in_[v]) {
+                        down[v].push_back(a);
+                        std::erase_if(out_[u], [v](const auto &entry) { return entry.first == v; });
+                        ++deleted_[u];
+                        touched.push_back(u);
+                    }
+                    out_[v].clear();
+                    in_[v].clear();
+                }
+                for (size_t v : independent) {
+                    for (auto [u, w, weight, a1, a2] : shortcuts[v]) {
+                        addArc(u, w, weight, a1, a2);
+                    }
+                    shortcuts[v].clear();
+                    shortcuts[v].shrink_to_fit();
+                }
+                std::erase_if(touched, [&](size_t v) {
+                    if (dirty[v]) {
+                        return true;
+                    }
+                    dirty[v] = true;
+                    return false;
+                });
+                detail::parallelFor(0, touched.size(), [&](size_t thread, size_t i) {
+                    priorities[touched[i]] = priority(touched[i], searches[thread]);
+                }, 4);
+                for (size_t v : touched) {
+                    dirty[v] = false;
+                }
+                std::erase_if(remaining, [&](size_t v) { return contracted_[v]; });
+            }
+            ch_.upOffsets_.assign(1, 0);
+            ch_.downOffsets_.assign(1, 0);
+            for (size_t v = 0; v < n; ++v) {
+                ch_.upArcs_.insert(ch_.upArcs_.end(), up[v].begin(), up[v].end());
+                ch_.upOffsets_.push_back(ch_.upArcs_.size());
+                ch_.downArcs_.insert(ch_.downArcs_.end(), down[v].begin(), down[v].end());
+                ch_.downOffsets_.push_back(ch_.downArcs_.size());
+            }
+        }
+
+    private:
+        ContractionHierarchy &ch_;
+        std::vector<std::vector<std::pair<size_t, size_t>>> out_;
+        std::vector<std::vector<std::pair<size_t, size_t>>> in_;
+        std::vector<uint8_t> contracted_;
+        std::vector<size_t> deleted_;
+        size_t witnessLimit_;
+    };
+
+    void build(std::vector<Weight> weights, size_t witnessLimit) {
+        Contraction contraction(*this, g_.numVertices(), witnessLimit);
+        for (size_t e = 0; e < g_.numEdges(); ++e) {
+            if (g_.source(e) != g_.target(e)) {
+                contraction.addArc(g_.source(e), g_.target(e), weights[e], e, kNpos);
+            }
+        }
+        contraction.run();
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <utility>
+
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph>
+class CoreSubgraph {
+public:
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+    template <typename V>
+    using VertexMap = Graph::template VertexMap<V>;
+
+    template <typename V>
+    using EdgeMap = Graph::template EdgeMap<V>;
+
+    template <typename CoreNumbers>
+    CoreSubgraph(Graph &g, const CoreNumbers &coreNumbers, size_t k) : g_(g) {
+        for (Vertex v : g_.vertices()) {
+            bool member = get(coreNumbers, v) >= k;
+            put(members_, v, member);
+            if (member) {
+                ++numVertices_;
+            }
+        }
+    }
+
+    size_t numVertices() const {
+        return numVertices_;
+    }
+
+    bool containsVertex(Vertex v) const {
+        return get(members_, v);
+    }
+
+    auto vertices() const {
+        return g_.vertices() | std::views::filter([this](Vertex v) { return get(members_, v); });
+    }
+
+    size_t numOutEdges(Vertex v) const {
+        return static_cast<size_t>(std::ranges::distance(outEdges(v)));
+    }
+
+    auto outEdges(Vertex v) const {
+        return g_.outEdges(v) | std::views::filter([this](Edge e) { return get(members_, g_.target(e)); });
+    }
+
+    Vertex source(Edge e) const {
+        return g_.source(e);
+    }
+
+    Vertex target(Edge e) const {
+        return g_.target(e);
+    }
+
+    template <typename T>
+    decltype(auto) operator[](T &&key) const {
+        return g_[std::forward<T>(key)];
+    }
+
+private:
+    Graph &g_;
+    VertexMap<bool> members_;
+    size_t numVertices_ = 0;
+};
+
+} // namespace graph
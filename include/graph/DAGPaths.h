@@ -0,0 +1,191 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+#include "graph/Matrix.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class DAGPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    DAGPaths(Graph &g, Weights weights) : g_(g), weights_(g_.edgeValues(weights)), positions_(g_.numVertices()) {
+        size_t n = g_.numVertices();
+        std::vector<size_t> in(n);
+        for (size_t e = 0; e < g_.numEdges(); ++e) {
+            ++in[g_.target(e)];
+        }
+        for (size_t v = 0; v < n; ++v) {
+            if (in[v] == 0) {
+                order_.push_back(v);
+            }
+        }
+        for (size_t i = 0; i < order_.size(); ++i) {
+            size_t u = order_[i];
+            positions_[u] = i;
+            for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                if (--in[g_.target(e)] == 0) {
+                    order_.push_back(g_.target(e));
+                }
+            }
+        }
+        if (order_.size() != n) {
+            throw std::invalid_argument("DAGPaths: graph has a cycle");
+        }
+    }
+
+    template <typename Dists, typename Preds>
+    void shortestPaths(Vertex s, Dists dists, Preds preds) const {
+        singleSource<false>(s, dists, preds);
+    }
+
+    template <typename Dists, typename Preds>
+    void longestPaths(Vertex s, Dists dists, Preds preds) const {
+        singleSource<true>(s, dists, preds);
+    }
+
+    void shortestPaths(const std::vector<Vertex> &sources, const std::vector<Vertex> &targets, Matrix<Weight> *dists) const {
+        multiSource<false>(sources, targets, dists);
+    }
+
+    void longestPaths(const std::vector<Vertex> &sources, const std::vector<Vertex> &targets, Matrix<Weight> *dists) const {
+        multiSource<true>(sources, targets, dists);
+    }
+
+    template <typename Slacks>
+    std::pair<Weight, std::vector<Edge>> criticalPath(Slacks slacks) const {
+        size_t n = g_.numVertices();
+        std::vector<Weight> earliest(n, 0);
+        std::vector<size_t> preds(n, kNpos);
+        for (size_t u : order_) {
+            for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                size_t v = g_.target(e);
+                if (earliest[v] < earliest[u] + weights_[e]) {
+                    earliest[v] = earliest[u] + weights_[e];
+                    preds[v] = e;
+                }
+            }
+        }
+        Weight length = 0;
+        size_t last = kNpos;
+        for (size_t v = 0; v < n; ++v) {
+            if (last == kNpos || length < earliest[v]) {
+                length = earliest[v];
+                last = v;
+            }
+        }
+        std::vector<Weight> latest(n, length);
+        for (size_t i = n; i-- > 0;) {
+            size_t u = order_[i];
+            for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                latest[u] = std::min(latest[u], latest[g_.target(e)] - weights_[e]);
+            }
+            put(slacks, g_.vertex(u), latest[u] - earliest[u]);
+        }
+        std::vector<Edge> path;
+        for (size_t v = last; v != kNpos && preds[v] != kNpos; v = g_.source(preds[v])) {
+            path.push_back(g_.edge(preds[v]));
+        }
+        std::ranges::reverse(path);
+        return {length, std::move(path)};
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    detail::IndexedGraph<Graph> g_;
+    std::vector<Weight> weights_;
+    std::vector<size_t> order_;
+    std::vector<size_t> positions_;
+
+    template <bool Longest>
+    static bool better(Weight candidate, Weight current) {
+        if constexpr (Longest) {
+            return current == kInfinity<Weight> || current < candidate;
+        } else {
+            return candidate < current;
+        }
+    }
+
+    template <bool Longest, typename Dists, typename Preds>
+    void singleSource(Vertex s, Dists &dists, Preds &preds) const {
+        size_t n = g_.numVertices();
+        std::vector<Weight> D(n, kInfinity<Weight>);
+        std::vector<size_t> P(n, kNpos);
+        size_t si = g_.index(s);
+        D[si] = 0;
+        for (size_t i = positions_[si]; i < n; ++i) {
+            size_t u = order_[i];
+            if (D[u] == kInfinity<Weight>) {
+                continue;
+            }
+            for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                size_t v = g_.target(e);
+                if (better<Longest>(D[u] + weights_[e], D[v])) {
+                    D[v] = D[u] + weights_[e];
+                    P[v] = u;
+                }
+            }
+        }
+        for (size_t v = 0; v < n; ++v) {
+            put(dists, g_.vertex(v), D[v]);
+            if (P[v] == kNpos) {
+                put(preds, g_.vertex(v), std::nullopt);
+            } else {
+                put(preds, g_.vertex(v), g_.vertex(P[v]));
+            }
+        }
+    }
+
+    template <bool Longest>
+    void multiSource(const std::vector<Vertex> &sources, const std::vector<Vertex> &targets, Matrix<Weight> *dists) const {
+        size_t n = g_.numVertices();
+        size_t k = sources.size();
+        std::vector<Weight> D(n * k, kInfinity<Weight>);
+        size_t first = n;
+        for (size_t i = 0; i < k; ++i) {
+            size_t s = g_.index(sources[i]);
+            D[s * k + i] = 0;
+            first = std::min(first, positions_[s]);
+        }
+        for (size_t p = first; p < n; ++p) {
+            size_t u = order_[p];
+            const Weight *du = D.data() + u * k;
+            for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                Weight w = weights_[e];
+                Weight *dv = D.data() + g_.target(e) * k;
+                for (size_t i = 0; i < k; ++i) {
+                    Weight candidate = du[i] == kInfinity<Weight> ? kInfinity<Weight> : du[i] + w;
+                    if constexpr (Longest) {
+                        dv[i] = candidate != kInfinity<Weight> && (dv[i] == kInfinity<Weight> || dv[i] < candidate)
+                                    ? candidate
+                                    : dv[i];
+                    } else {
+                        dv[i] = std::min(dv[i], candidate);
+                    }
+                }
+            }
+        }
+        dists->assign(k, targets.size(), Infinity());
+        for (size_t j = 0; j < targets.size(); ++j) {
+            size_t t = g_.index(targets[j]);
+            for (size_t i = 0; i < k; ++i) {
+                (*dists)(i, j) = D[t * k + i];
+            }
+        }
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Key,
+          typename Priority,
+          size_t D = 4,
+          typename Positions = std::unordered_map<Key, size_t>>
+class DaryHeap {
+    static_assert(D >= 2);
+
+public:
+    DaryHeap() = default;
+
+    explicit DaryHeap(Positions positions) : positions_(std::move(positions)) {}
+
+    bool empty() const {
+        return heap_.empty();
+    }
+
+    const std::pair<Priority, Key> &top() const {
+        return heap_.front();
+    }
+
+    void push(Key key, Priority priority) {
+        heap_.push_back({std::move(priority), std::move(key)});
+        siftUp(heap_.size() - 1);
+    }
+
+    void decrease(Key key, Priority, Priority newPriority) {
+        size_t i = get(positions_, key);
+        if (i == kNpos) {
+            push(std::move(key), std::move(newPriority));
+            return;
+        }
+        heap_[i].first = std::move(newPriority);
+        siftUp(i);
+    }
+
+    std::pair<Priority, Key> pop() {
+        std::pair<Priority, Key> top = std::move(heap_.front());
+        put(positions_, top.second, kNpos);
+        if (heap_.size() > 1) {
+            heap_.front() = std::move(heap_.back());
+            heap_.pop_back();
+            siftDown(0);
+        } else {
+            heap_.pop_back();
+        }
+        return top;
+    }
+
+    void clear() {
+        for (const auto &item : heap_) {
+            put(positions_, item.second, kNpos);
+        }
+        heap_.clear();
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    std::vector<std::pair<Priority, Key>> heap_;
+    Positions positions_;
+
+    void siftUp(size_t i) {
+        std::pair<Priority, Key> item = std::move(heap_[i]);
+        while (i > 0) {
+            size_t parent = (i - 1) / D;
+            if (!(item.first < heap_[parent].first)) {
+                break;
+            }
+            heap_[i] = std::move(heap_[parent]);
+            put(positions_, heap_[i].second, i);
+            i = parent;
+        }
+        heap_[i] = std::move(item);
+        put(positions_, heap_[i].second, i);
+    }
+
+    void siftDown(size_t i) {
+        std::pair<Priority, Key> item = std::move(heap_[i]);
+        size_t n = heap_.size();
+        while (true) {
+            size_t first = i * D + 1;
+            if (first >= n) {
+                break;
+            }
+            size_t last = first + D < n ? first + D : n;
+            size_t child = first;
+            for (size_t j = first + 1; j < last; ++j) {
+                if (heap_[j].first < heap_[child].first) {
+                    child = j;
+                }
+            }
+            if (!(heap_[child].first < item.first)) {
+                break;
+            }
+            heap_[i] = std::move(heap_[child]);
+            put(positions_, heap_[i].second, i);
+            i = child;
+        }
+        heap_[i] = std::move(item);
+        put(positions_, heap_[i].second, i);
+    }
+};
+
+} // namespace graph
@@ -69,7 +69,7 @@ public:
     class OutEdgeIterator {
     public:
         using iterator_category = std::bidirectional_iterator_tag;
-        using Value = Edge;
+        using value_type = Edge;
         using difference_type = ptrdiff_t;
 
         OutEdgeIterator() = default;
@@ -274,6 +274,10 @@ public:
         return Edge(source, list.insert(list.end(), {target, std::move(props)}));
     }
 
+    void removeEdge(Edge edge) {
+        get(adj_, edge.source_).second().erase(edge.node_);
+    }
+
 private:
     std::unordered_map<
         Vertex,
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/atomic.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights, typename Dists, typename Preds>
+class DeltaSteppingShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    DeltaSteppingShortestPaths(Graph &g,
+                               Vertex s,
+                               Weights weights,
+                               Dists dists,
+                               Preds preds,
+                               std::optional<Weight> delta = std::nullopt)
+        : g_(g),
+          s_(s),
+          weights_(std::move(weights)),
+          dists_(std::move(dists)),
+          preds_(std::move(preds)),
+          delta_(delta) {
+        if (delta_.has_value() && !(0 < *delta_)) {
+            throw std::invalid_argument("DeltaSteppingShortestPaths: delta must be positive");
+        }
+    }
+
+    void operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        std::vector<Weight> W = G.edgeValues(weights_);
+        size_t n = G.numVertices();
+        Weight maxWeight = 0;
+        for (Weight w : W) {
+            maxWeight = std::max(maxWeight, w);
+        }
+        Weight delta = delta_.has_value() ? *delta_ : chooseDelta(G, maxWeight);
+        Weight limit = static_cast<Weight>(std::max<size_t>(n, 1));
+        if (maxWeight / delta > limit) {
+            if constexpr (std::is_floating_point_v<Weight>) {
+                delta = maxWeight / limit;
+            } else {
+                delta = divideUp(maxWeight, limit);
+            }
+        }
+        size_t slotCount = static_cast<size_t>(divideUp(maxWeight, delta)) + 1;
+
+        std::vector<Weight> D(n, kInfinity<Weight>);
+        std::vector<size_t> P(n, kNpos);
+        std::vector<Weight> relaxed(n, kInfinity<Weight>);
+        std::vector<size_t> phases(n, kNpos);
+        std::vector<std::vector<size_t>> B(slotCount);
+        size_t i = 0;
+        size_t pending = 0;
+        std::vector<std::vector<std::pair<size_t, size_t>>> requests(detail::threadCount());
+
+        auto relax = [&](size_t thread, size_t e, Weight d) {
+            size_t v = G.target(e);
+            if (detail::fetchMin(D[v], d)) {
+                detail::atomicStore(P[v], e);
+                requests[thread].push_back({(i + offset(d, delta, i, slotCount)) % slotCount, v});
+            }
+        };
+        auto flush = [&] {
+            for (auto &local : requests) {
+                for (auto [slot, v] : local) {
+                    B[slot].push_back(v);
+                }
+                pending += local.size();
+                local.clear();
+            }
+        };
+
+        size_t si = G.index(s_);
+        D[si] = 0;
+        B[0].push_back(si);
+        pending = 1;
+        std::vector<size_t> frontier;
+        std::vector<size_t> R;
+        for (; pending > 0; ++i) {
+            std::vector<size_t> &current = B[i % slotCount];
+            R.clear();
+            while (!current.empty()) {
+                pending -= current.size();
+                frontier.clear();
+                for (size_t v : current) {
+                    if (!(D[v] < relaxed[v])) {
+                        continue;
+                    }
+                    size_t k = offset(D[v], delta, i, slotCount);
+                    if (k != 0) {
+                        B[(i + k) % slotCount].push_back(v);
+                        ++pending;
+                    } else {
+                        relaxed[v] = D[v];
+                        frontier.push_back(v);
+                        if (phases[v] != i) {
+                            phases[v] = i;
+                            R.push_back(v);
+                        }
+                    }
+                }
+                current.clear();
+                detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t j) {
+                    size_t u = frontier[j];
+                    Weight du = relaxed[u];
+                    for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                        if (!(delta < W[e])) {
+                            relax(thread, e, du + W[e]);
+                        }
+                    }
+                }, 16);
+                flush();
+            }
+            detail::parallelFor(0, R.size(), [&](size_t thread, size_t j) {
+                size_t u = R[j];
+                Weight du = D[u];
+                for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                    if (delta < W[e]) {
+                        relax(thread, e, du + W[e]);
+                    }
+                }
+            }, 16);
+            flush();
+        }
+
+        for (size_t v = 0; v < n; ++v) {
+            size_t e = P[v];
+            if (e != kNpos && D[G.source(e)] + W[e] != D[v]) {
+                G.buildInEdges();
+                for (size_t k = G.inBegin(v); k < G.inEnd(v); ++k) {
+                    size_t f = G.inEdge(k);
+                    if (D[G.source(f)] + W[f] == D[v]) {
+                        P[v] = f;
+                        break;
+                    }
+                }
+            }
+        }
+        for (size_t v = 0; v < n; ++v) {
+            Vertex x = G.vertex(v);
+            put(dists_, x, D[v]);
+            if (P[v] == kNpos || v == si) {
+                put(preds_, x, std::nullopt);
+            } else {
+                put(preds_, x, G.vertex(G.source(P[v])));
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    Graph &g_;
+    Vertex s_;
+    Weights weights_;
+    Dists dists_;
+    Preds preds_;
+    std::optional<Weight> delta_;
+
+    static Weight divideUp(Weight a, Weight b) {
+        if constexpr (std::is_floating_point_v<Weight>) {
+            return std::ceil(a / b);
+        } else {
+            return a / b + (a % b != 0 ? 1 : 0);
+        }
+    }
+
+    static size_t offset(Weight d, Weight delta, size_t i, size_t slotCount) {
+        if constexpr (std::is_floating_point_v<Weight>) {
+            Weight k = std::floor(d / delta) - static_cast<Weight>(i);
+            if (!(k > 0)) {
+                return 0;
+            }
+            return k < static_cast<Weight>(slotCount - 1) ? static_cast<size_t>(k) : slotCount - 1;
+        } else {
+            size_t b = static_cast<size_t>(d / delta);
+            return b <= i ? 0 : std::min(b - i, slotCount - 1);
+        }
+    }
+
+    static Weight chooseDelta(const detail::IndexedGraph<Graph> &G, Weight maxWeight) {
+        size_t degree = G.numVertices() == 0 ? 1 : std::max<size_t>(G.numEdges() / G.numVertices(), 1);
+        Weight delta = maxWeight / static_cast<Weight>(degree);
+        return delta > 0 ? delta : Weight(1);
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/Brandes.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Sink.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights, typename Centralities,
+          typename EdgeCentralities = Sink<typename Graph::Edge, typename GeneralizedMapTraits<Centralities>::Value>>
+class DijkstraBetweennessCentrality {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+    using Centrality = GeneralizedMapTraits<Centralities>::Value;
+
+public:
+    DijkstraBetweennessCentrality(Graph &g, Weights weights, Centralities centralities,
+                                  EdgeCentralities edgeCentralities = {})
+        : g_(g),
+          weights_(std::move(weights)),
+          centralities_(std::move(centralities)),
+          edgeCentralities_(std::move(edgeCentralities)) {}
+
+    void operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        std::vector<Weight> weights = G.edgeValues(weights_);
+        detail::Brandes<Graph, Centrality, Weight> B(G, &weights, kWithEdges);
+        B.exact();
+        write(G, B);
+    }
+
+    Centrality approximate(size_t sampleCount, Centrality delta = 0.1, unsigned seed = 0) {
+        detail::IndexedGraph<Graph> G(g_);
+        std::vector<Weight> weights = G.edgeValues(weights_);
+        detail::Brandes<Graph, Centrality, Weight> B(G, &weights, kWithEdges);
+        Centrality error = B.sample(sampleCount, delta, seed);
+        write(G, B);
+        return error;
+    }
+
+private:
+    static constexpr bool kWithEdges = !std::is_same_v<EdgeCentralities, Sink<Edge, Centrality>>;
+
+    Graph &g_;
+    Weights weights_;
+    Centralities centralities_;
+    EdgeCentralities edgeCentralities_;
+
+    void write(const detail::IndexedGraph<Graph> &G, const detail::Brandes<Graph, Centrality, Weight> &B) {
+        for (size_t v = 0; v < G.numVertices(); ++v) {
+            put(centralities_, G.vertex(v), B.vertexScores()[v]);
+        }
+        if constexpr (kWithEdges) {
+            for (size_t e = 0; e < G.numEdges(); ++e) {
+                put(edgeCentralities_, G.edge(e), B.edgeScores()[e]);
+            }
+        }
+    }
+};
+
+} // namespace graph
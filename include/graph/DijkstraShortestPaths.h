@@ -1,27 +1,33 @@
 #pragma once
 
-#include <set>
 #include <optional>
 #include <utility>
 
 #include "graph/GeneralizedMaps.h"
 #include "graph/Infinity.h"
+#include "graph/SetPriorityQueue.h"
 
 namespace graph {
 
-template <typename Graph, typename Weights, typename Dists, typename Preds>
+template <typename Graph,
+          typename Weights,
+          typename Dists,
+          typename Preds,
+          typename PriorityQueue = SetPriorityQueue<typename Graph::Vertex,
+                                                    typename GeneralizedMapTraits<Weights>::Value>>
 class DijkstraShortestPaths {
     using Vertex = Graph::Vertex;
     using Edge = Graph::Edge;
     using Weight = GeneralizedMapTraits<Weights>::Value;
 
 public:
-    DijkstraShortestPaths(Graph &g, Vertex s, Weights weights, Dists dists, Preds preds)
+    DijkstraShortestPaths(Graph &g, Vertex s, Weights weights, Dists dists, Preds preds, PriorityQueue queue = {})
         : g_(g),
           s_(s),
           weights_(std::move(weights)),
           dists_(std::move(dists)),
-          preds_(std::move(preds)) {}
+          preds_(std::move(preds)),
+          queue_(std::move(queue)) {}
 
     void operator()() {
         for (Vertex v : g_.vertices()) {
@@ -30,18 +36,24 @@ public:
         }
         put(dists_, s_, 0);
         put(preds_, s_, std::nullopt);
-        std::set<std::pair<Weight, Vertex>> U{{0, s_}};
-        while (!U.empty()) {
-            Vertex u = U.begin()->second;
-            U.erase(U.begin());
+        queue_.push(s_, 0);
+        while (!queue_.empty()) {
+            auto [d, u] = queue_.pop();
+            if (get(dists_, u) < d) {
+                continue;
+            }
             for (Edge e : g_.outEdges(u)) {
                 Vertex v = g_.target(e);
                 Weight w = get(weights_, e);
                 if (get(dists_, v) > get(dists_, u) + w) {
-                    U.erase({get(dists_, v), v});
+                    Weight old = get(dists_, v);
                     put(dists_, v, get(dists_, u) + w);
                     put(preds_, v, u);
-                    U.insert({get(dists_, v), v});
+                    if (old == Infinity()) {
+                        queue_.push(v, get(dists_, v));
+                    } else {
+                        queue_.decrease(v, old, get(dists_, v));
+                    }
                 }
             }
         }
@@ -53,6 +65,7 @@ private:
     Weights weights_;
     Dists dists_;
     Preds preds_;
+    PriorityQueue queue_;
 };
 
 } // namespace graph
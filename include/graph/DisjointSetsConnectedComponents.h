@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "graph/detail/DisjointSets.h"
+#include "graph/detail/IndexedGraph.h"
 #include "graph/GeneralizedMaps.h"
 
 namespace graph {
@@ -18,23 +19,16 @@ public:
         : g_(g), representativeVertices_(std::move(representativeVertices)) {}
     
     size_t operator()() {
-        detail::DisjointSets<Vertex> D;
-        size_t componentCount = 0;
-        for (Vertex v : g_.vertices()) {
-            D.makeSet(v);
-            ++componentCount;
-        }
-        for (Vertex u : g_.vertices()) {
-            for (Edge e : g_.outEdges(u)) {
-                Vertex v = g_.target(e);
-                if (D.find(u) != D.find(v)) {
-                    D.union_(u, v);
-                    --componentCount;
-                }
+        detail::IndexedGraph<Graph> g(g_);
+        detail::DisjointSets D(g.numVertices());
+        size_t componentCount = g.numVertices();
+        for (size_t e = 0; e < g.numEdges(); ++e) {
+            if (D.union_(g.source(e), g.target(e))) {
+                --componentCount;
             }
         }
-        for (Vertex v : g_.vertices()) {
-            put(representativeVertices_, v, D.find(v));
+        for (size_t v = 0; v < g.numVertices(); ++v) {
+            put(representativeVertices_, g.vertex(v), g.vertex(D.find(v)));
         }
         return componentCount;
     }
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+#include "graph/LazyBinaryHeap.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights, typename Dists, typename Preds>
+class DynamicShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+    template <typename V>
+    using VertexMap = Graph::template VertexMap<V>;
+
+public:
+    DynamicShortestPaths(Graph &g, Vertex s, Weights weights, Dists dists, Preds preds)
+        : g_(g),
+          s_(s),
+          weights_(std::move(weights)),
+          dists_(std::move(dists)),
+          preds_(std::move(preds)) {}
+
+    void operator()() {
+        inEdges_ = {};
+        predEdges_ = {};
+        affected_ = {};
+        increased_.clear();
+        decreased_.clear();
+        for (Vertex v : g_.vertices()) {
+            put(dists_, v, Infinity());
+            put(preds_, v, std::nullopt);
+            put(predEdges_, v, std::nullopt);
+            put(inEdges_, v, {});
+            put(affected_, v, false);
+        }
+        for (Vertex u : g_.vertices()) {
+            for (Edge e : g_.outEdges(u)) {
+                get(inEdges_, g_.target(e)).push_back(e);
+            }
+        }
+        put(dists_, s_, 0);
+        LazyBinaryHeap<Vertex, Weight> Q;
+        Q.push(s_, 0);
+        propagate(Q);
+    }
+
+    void insertVertex(Vertex v) {
+        put(dists_, v, Infinity());
+        put(preds_, v, std::nullopt);
+        put(predEdges_, v, std::nullopt);
+        put(inEdges_, v, {});
+        put(affected_, v, false);
+    }
+
+    void insertEdge(Edge e) {
+        get(inEdges_, g_.target(e)).push_back(e);
+        decreased_.push_back(e);
+    }
+
+    void removeEdge(Edge e) {
+        std::vector<Edge> &in = get(inEdges_, g_.target(e));
+        for (size_t i = 0; i < in.size(); ++i) {
+            if (in[i] == e) {
+                in[i] = in.back();
+                in.pop_back();
+                break;
+            }
+        }
+        std::erase(decreased_, e);
+        if (get(predEdges_, g_.target(e)) == e) {
+            put(predEdges_, g_.target(e), std::nullopt);
+            increased_.push_back(g_.target(e));
+        }
+    }
+
+    void changeWeight(Edge e, Weight weight) {
+        Weight old = get(weights_, e);
+        put(weights_, e, weight);
+        if (weight < old) {
+            decreased_.push_back(e);
+        } else if (old < weight && get(predEdges_, g_.target(e)) == e) {
+            increased_.push_back(g_.target(e));
+        }
+    }
+
+    void repair() {
+        std::vector<Vertex> region;
+        std::queue<Vertex> Q;
+        for (Vertex v : increased_) {
+            if (!get(affected_, v)) {
+                put(affected_, v, true);
+                Q.push(v);
+            }
+        }
+        while (!Q.empty()) {
+            Vertex u = Q.front();
+            Q.pop();
+            region.push_back(u);
+            for (Edge e : g_.outEdges(u)) {
+                Vertex v = g_.target(e);
+                if (!get(affected_, v) && get(predEdges_, v) == e) {
+                    put(affected_, v, true);
+                    Q.push(v);
+                }
+            }
+        }
+        for (Vertex v : region) {
+            put(affected_, v, false);
+            put(dists_, v, Infinity());
+            put(preds_, v, std::nullopt);
+            put(predEdges_, v, std::nullopt);
+        }
+        LazyBinaryHeap<Vertex, Weight> H;
+        for (Vertex v : region) {
+            if (v == s_) {
+                put(dists_, v, 0);
+                H.push(v, 0);
+                continue;
+            }
+            for (Edge e : get(inEdges_, v)) {
+                relax(e, H);
+            }
+        }
+        for (Edge e : decreased_) {
+            relax(e, H);
+        }
+        increased_.clear();
+        decreased_.clear();
+        propagate(H);
+    }
+
+private:
+    Graph &g_;
+    Vertex s_;
+    Weights weights_;
+    Dists dists_;
+    Preds preds_;
+    VertexMap<std::vector<Edge>> inEdges_;
+    VertexMap<std::optional<Edge>> predEdges_;
+    VertexMap<bool> affected_;
+    std::vector<Vertex> increased_;
+    std::vector<Edge> decreased_;
+
+    void relax(Edge e, LazyBinaryHeap<Vertex, Weight> &H) {
+        Vertex u = g_.source(e);
+        Vertex v = g_.target(e);
+        if (get(dists_, u) == Infinity()) {
+            return;
+        }
+        Weight d = get(dists_, u) + get(weights_, e);
+        if (get(dists_, v) > d) {
+            put(dists_, v, d);
+            put(preds_, v, u);
+            put(predEdges_, v, e);
+            H.push(v, d);
+        }
+    }
+
+    void propagate(LazyBinaryHeap<Vertex, Weight> &H) {
+        while (!H.empty()) {
+            auto [d, u] = H.pop();
+            if (get(dists_, u) < d) {
+                continue;
+            }
+            for (Edge e : g_.outEdges(u)) {
+                relax(e, H);
+            }
+        }
+    }
+};
+
+} // namespace graph
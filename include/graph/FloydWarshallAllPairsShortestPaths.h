@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+#include "graph/Matrix.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class FloydWarshallAllPairsShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    static constexpr size_t kNpos = -1;
+
+    FloydWarshallAllPairsShortestPaths(Graph &g,
+                                       Weights weights,
+                                       Matrix<Weight> *dists,
+                                       Matrix<size_t> *successors = nullptr)
+        : g_(g), weights_(std::move(weights)), dists_(dists), successors_(successors) {}
+
+    std::optional<std::vector<Vertex>> operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        dists_->assign(n, n, Infinity());
+        if (successors_ != nullptr) {
+            successors_->assign(n, n, kNpos);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            (*dists_)(i, i) = 0;
+            if (successors_ != nullptr) {
+                (*successors_)(i, i) = i;
+            }
+        }
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            size_t i = G.source(e);
+            size_t j = G.target(e);
+            Weight w = get(weights_, G.edge(e));
+            if (w < (*dists_)(i, j)) {
+                (*dists_)(i, j) = w;
+                if (successors_ != nullptr) {
+                    (*successors_)(i, j) = j;
+                }
+            }
+        }
+        if (successors_ != nullptr) {
+            run<true>(n);
+        } else {
+            run<false>(n);
+        }
+        std::vector<Vertex> vertices;
+        for (size_t i = 0; i < n; ++i) {
+            if ((*dists_)(i, i) < 0) {
+                return std::nullopt;
+            }
+            vertices.push_back(G.vertex(i));
+        }
+        return vertices;
+    }
+
+private:
+    static constexpr size_t kBlock = 64;
+
+    Graph &g_;
+    Weights weights_;
+    Matrix<Weight> *dists_;
+    Matrix<size_t> *successors_;
+
+    template <bool kSuccessors>
+    void run(size_t n) {
+        size_t blocks = (n + kBlock - 1) / kBlock;
+        for (size_t kb = 0; kb < blocks; ++kb) {
+            update<kSuccessors>(kb, kb, kb, n);
+            detail::parallelFor(0, 2 * blocks, [&](size_t x) {
+                size_t b = x / 2;
+                if (b != kb) {
+                    if (x % 2 == 0) {
+                        update<kSuccessors>(kb, b, kb, n);
+                    } else {
+                        update<kSuccessors>(b, kb, kb, n);
+                    }
+                }
+            }, 1);
+            detail::parallelFor(0, blocks * blocks, [&](size_t x) {
+                size_t ib = x / blocks;
+                size_t jb = x % blocks;
+                if (ib != kb && jb != kb) {
+                    update<kSuccessors>(ib, jb, kb, n);
+                }
+            }, 1);
+        }
+    }
+
+    template <bool kSuccessors>
+    void update(size_t ib, size_t jb, size_t kb, size_t n) {
+        size_t iEnd = std::min((ib + 1) * kBlock, n);
+        size_t jBegin = jb * kBlock;
+        size_t jEnd = std::min((jb + 1) * kBlock, n);
+        size_t kEnd = std::min((kb + 1) * kBlock, n);
+        for (size_t k = kb * kBlock; k < kEnd; ++k) {
+            const Weight *dk = dists_->row(k);
+            for (size_t i = ib * kBlock; i < iEnd; ++i) {
+                Weight *di = dists_->row(i);
+                Weight dik = di[k];
+                if (dik == kInfinity<Weight>) {
+                    continue;
+                }
+                if constexpr (kSuccessors) {
+                    size_t *si = successors_->row(i);
+                    size_t sik = si[k];
+                    for (size_t j = jBegin; j < jEnd; ++j) {
+                        if (dk[j] != kInfinity<Weight> && dik + dk[j] < di[j]) {
+                            di[j] = dik + dk[j];
+                            si[j] = sik;
+                        }
+                    }
+                } else {
+                    for (size_t j = jBegin; j < jEnd; ++j) {
+                        Weight d = dk[j] == kInfinity<Weight> ? kInfinity<Weight> : dik + dk[j];
+                        di[j] = d < di[j] ? d : di[j];
+                    }
+                }
+            }
+        }
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/atomic.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename SccNumbers>
+class ForwardBackwardStronglyConnectedComponents {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    ForwardBackwardStronglyConnectedComponents(Graph &g, SccNumbers sccNumbers)
+        : g_(g), sccNumbers_(std::move(sccNumbers)) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        G.buildInEdges();
+        size_t n = G.numVertices();
+        std::vector<size_t> S(n, kNpos);
+
+        trim(G, S);
+        trimPairs(G, S);
+        trim(G, S);
+        forwardBackward(G, S);
+        color(G, S);
+
+        std::vector<size_t> numbers(n, kNpos);
+        size_t sccCount = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (S[v] == v) {
+                numbers[v] = sccCount++;
+            }
+        }
+        for (size_t v = 0; v < n; ++v) {
+            put(sccNumbers_, G.vertex(v), numbers[S[v]]);
+        }
+        return sccCount;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    Graph &g_;
+    SccNumbers sccNumbers_;
+
+    static bool claim(std::vector<size_t> &S, size_t v, size_t scc) {
+        size_t expected = kNpos;
+        return std::atomic_ref<size_t>(S[v]).compare_exchange_strong(expected, scc, std::memory_order_relaxed);
+    }
+
+    static void trim(const detail::IndexedGraph<Graph> &G, std::vector<size_t> &S) {
+        size_t n = G.numVertices();
+        std::vector<size_t> inDegrees(n);
+        std::vector<size_t> outDegrees(n);
+        detail::parallelFor(0, n, [&](size_t v) {
+            if (S[v] != kNpos) {
+                return;
+            }
+            for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                size_t w = G.target(e);
+                outDegrees[v] += w != v && S[w] == kNpos;
+            }
+            for (size_t i = G.inBegin(v); i < G.inEnd(v); ++i) {
+                size_t w = G.source(G.inEdge(i));
+                inDegrees[v] += w != v && S[w] == kNpos;
+            }
+        });
+
+        std::vector<size_t> frontier;
+        for (size_t v = 0; v < n; ++v) {
+            if (S[v] == kNpos && (inDegrees[v] == 0 || outDegrees[v] == 0)) {
+                S[v] = v;
+                frontier.push_back(v);
+            }
+        }
+        std::vector<std::vector<size_t>> next(detail::threadCount());
+        while (!frontier.empty()) {
+            detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t i) {
+                size_t u = frontier[i];
+                for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                    size_t w = G.target(e);
+                    if (w != u && std::atomic_ref<size_t>(inDegrees[w]).fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                        claim(S, w, w)) {
+                        next[thread].push_back(w);
+                    }
+                }
+                for (size_t j = G.inBegin(u); j < G.inEnd(u); ++j) {
+                    size_t w = G.source(G.inEdge(j));
+                    if (w != u && std::atomic_ref<size_t>(outDegrees[w]).fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                        claim(S, w, w)) {
+                        next[thread].push_back(w);
+                    }
+                }
+            }, 64);
+            frontier.clear();
+            for (std::vector<size_t> &local : next) {
+                frontier.insert(frontier.end(), local.begin(), local.end());
+                local.clear();
+            }
+        }
+    }
+
+    static void trimPairs(const detail::IndexedGraph<Graph> &G, std::vector<size_t> &S) {
+        size_t n = G.numVertices();
+        std::vector<size_t> inPartners(n, kNpos);
+        std::vector<size_t> outPartners(n, kNpos);
+        detail::parallelFor(0, n, [&](size_t v) {
+            if (S[v] != kNpos) {
+                return;
+            }
+            size_t partner = kNpos;
+            bool unique = true;
+            for (size_t e = G.outBegin(v); e < G.outEnd(v) && unique; ++e) {
+                size_t w = G.target(e);
+                if (w != v && S[w] == kNpos) {
+                    unique = partner == kNpos || partner == w;
+                    partner = w;
+                }
+            }
+            outPartners[v] = unique ? partner : kNpos;
+            partner = kNpos;
+            unique = true;
+            for (size_t i = G.inBegin(v); i < G.inEnd(v) && unique; ++i) {
+                size_t w = G.source(G.inEdge(i));
+                if (w != v && S[w] == kNpos) {
+                    unique = partner == kNpos || partner == w;
+                    partner = w;
+                }
+            }
+            inPartners[v] = unique ? partner : kNpos;
+        });
+        detail::parallelFor(0, n, [&](size_t v) {
+            size_t w = inPartners[v];
+            if (w != kNpos && v < w && inPartners[w] == v) {
+                S[v] = v;
+                S[w] = v;
+                return;
+            }
+            w = outPartners[v];
+            if (w != kNpos && v < w && outPartners[w] == v) {
+                S[v] = v;
+                S[w] = v;
+            }
+        });
+    }
+
+    static void forwardBackward(const detail::IndexedGraph<Graph> &G, std::vector<size_t> &S) {
+        size_t n = G.numVertices();
+        size_t pivot = kNpos;
+        size_t best = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (S[v] == kNpos && (pivot == kNpos || G.inDegree(v) * G.outDegree(v) > best)) {
+                pivot = v;
+                best = G.inDegree(v) * G.outDegree(v);
+            }
+        }
+        if (pivot == kNpos) {
+            return;
+        }
+        std::vector<uint8_t> forward(n);
+        std::vector<uint8_t> backward(n);
+        reach(G, S, pivot, true, forward);
+        reach(G, S, pivot, false, backward);
+        detail::parallelFor(0, n, [&](size_t v) {
+            if (forward[v] && backward[v]) {
+                S[v] = pivot;
+            }
+        });
+    }
+
+    static void reach(const detail::IndexedGraph<Graph> &G,
+                      std::vector<size_t> &S,
+                      size_t s,
+                      bool forward,
+                      std::vector<uint8_t> &visited) {
+        std::vector<size_t> frontier{s};
+        std::vector<std::vector<size_t>> next(detail::threadCount());
+        visited[s] = true;
+        auto visit = [&](size_t thread, size_t w) {
+            if (S[w] != kNpos || detail::atomicLoad(visited[w])) {
+                return;
+            }
+            uint8_t expected = false;
+            if (std::atomic_ref<uint8_t>(visited[w]).compare_exchange_strong(expected, true, std::memory_order_relaxed)) {
+                next[thread].push_back(w);
+            }
+        };
+        while (!frontier.empty()) {
+            detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t i) {
+                size_t u = frontier[i];
+                if (forward) {
+                    for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                        visit(thread, G.target(e));
+                    }
+                } else {
+                    for (size_t j = G.inBegin(u); j < G.inEnd(u); ++j) {
+                        visit(thread, G.source(G.inEdge(j)));
+                    }
+                }
+            }, 64);
+            frontier.clear();
+            for (std::vector<size_t> &local : next) {
+                frontier.insert(frontier.end(), local.begin(), local.end());
+                local.clear();
+            }
+        }
+    }
+
+    static void color(const detail::IndexedGraph<Graph> &G, std::vector<size_t> &S) {
+        size_t n = G.numVertices();
+        std::vector<size_t> colors(n);
+        std::vector<uint8_t> queued(n);
+        std::vector<size_t> frontier;
+        std::vector<std::vector<size_t>> next(detail::threadCount());
+        std::vector<size_t> roots;
+        while (true) {
+            frontier.clear();
+            for (size_t v = 0; v < n; ++v) {
+                if (S[v] == kNpos) {
+                    colors[v] = v;
+                    frontier.push_back(v);
+                }
+            }
+            if (frontier.empty()) {
+                break;
+            }
+
+            while (!frontier.empty()) {
+                detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t i) {
+                    size_t u = frontier[i];
+                    size_t c = detail::atomicLoad(colors[u]);
+                    for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                        size_t w = G.target(e);
+                        if (S[w] != kNpos || !detail::fetchMax(colors[w], c)) {
+                            continue;
+                        }
+                        uint8_t expected = false;
+                        if (std::atomic_ref<uint8_t>(queued[w]).compare_exchange_strong(
+                                expected, true, std::memory_order_relaxed)) {
+                            next[thread].push_back(w);
+                        }
+                    }
+                }, 64);
+                frontier.clear();
+                for (std::vector<size_t> &local : next) {
+                    for (size_t w : local) {
+                        queued[w] = false;
+                    }
+                    frontier.insert(frontier.end(), local.begin(), local.end());
+                    local.clear();
+                }
+            }
+
+            roots.clear();
+            for (size_t v = 0; v < n; ++v) {
+                if (S[v] == kNpos && colors[v] == v) {
+                    roots.push_back(v);
+                }
+            }
+            detail::parallelFor(0, roots.size(), [&](size_t i) {
+                size_t r = roots[i];
+                std::vector<size_t> stack{r};
+                S[r] = r;
+                while (!stack.empty()) {
+                    size_t u = stack.back();
+                    stack.pop_back();
+                    for (size_t j = G.inBegin(u); j < G.inEnd(u); ++j) {
+                        size_t w = G.source(G.inEdge(j));
+                        if (colors[w] == r && claim(S, w, r)) {
+                            stack.push_back(w);
+                        }
+                    }
+                }
+            }, 1);
+        }
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/binary.h"
+#include "graph/detail/ConcurrentDisjointSets.h"
+#include "graph/detail/ThreadPool.h"
+
+namespace graph {
+
+class IncrementalConnectivity {
+public:
+    explicit IncrementalConnectivity(size_t n = 0) : sets_(n), sizes_(n, 1), componentCount_(n) {}
+
+    static IncrementalConnectivity load(std::istream &in) {
+        uint64_t magic = 0;
+        uint64_t componentCount = 0;
+        std::vector<size_t> parents;
+        std::vector<size_t> sizes;
+        detail::readBinary(in, magic);
+        if (!in || magic != kMagic) {
+            throw std::runtime_error("IncrementalConnectivity: incompatible input");
+        }
+        detail::readBinary(in, componentCount);
+        detail::readBinary(in, parents);
+        detail::readBinary(in, sizes);
+        if (!in) {
+            throw std::runtime_error("IncrementalConnectivity: truncated input");
+        }
+        if (parents.size() != sizes.size() || !valid(parents, sizes, componentCount)) {
+            throw std::runtime_error("IncrementalConnectivity: corrupt input");
+        }
+        IncrementalConnectivity ic;
+        ic.sets_ = detail::ConcurrentDisjointSets(std::move(parents));
+        ic.sizes_ = std::move(sizes);
+        ic.componentCount_ = componentCount;
+        return ic;
+    }
+
+    void save(std::ostream &out) const {
+        detail::writeBinary(out, kMagic);
+        detail::writeBinary(out, static_cast<uint64_t>(componentCount_));
+        detail::writeBinary(out, sets_.parents());
+        detail::writeBinary(out, sizes_);
+    }
+
+    size_t numVertices() const {
+        return sets_.size();
+    }
+
+    size_t numComponents() const {
+        return componentCount_;
+    }
+
+    size_t addVertex() {
+        sizes_.push_back(1);
+        ++componentCount_;
+        return sets_.makeSet();
+    }
+
+    bool insertEdge(size_t u, size_t v) {
+        size_t x = sets_.link(u, v);
+        if (x == kNpos) {
+            return false;
+        }
+        sizes_[sets_.find(x)] += sizes_[x];
+        --componentCount_;
+        return true;
+    }
+
+    size_t insertEdges(const std::vector<std::pair<size_t, size_t>> &edges) {
+        std::vector<std::vector<size_t>> linked(detail::threadCount());
+        detail::parallelFor(0, edges.size(), [&](size_t thread, size_t i) {
+            size_t x = sets_.link(edges[i].first, edges[i].second);
+            if (x != kNpos) {
+                linked[thread].push_back(x);
+            }
+        });
+        size_t mergeCount = 0;
+        for (const std::vector<size_t> &local : linked) {
+            detail::parallelFor(0, local.size(), [&](size_t i) {
+                size_t x = local[i];
+                std::atomic_ref<size_t>(sizes_[sets_.find(x)]).fetch_add(sizes_[x], std::memory_order_relaxed);
+            });
+            mergeCount += local.size();
+        }
+        componentCount_ -= mergeCount;
+        return mergeCount;
+    }
+
+    bool connected(size_t u, size_t v) {
+        return sets_.sameSet(u, v);
+    }
+
+    size_t component(size_t v) {
+        return sets_.find(v);
+    }
+
+    size_t componentSize(size_t v) {
+        return sizes_[sets_.find(v)];
+    }
+
+private:
+    static constexpr size_t kNpos = detail::ConcurrentDisjointSets::kNpos;
+    static constexpr uint64_t kMagic = 0x314e4e4370617267;
+
+    detail::ConcurrentDisjointSets sets_;
+    std::vector<size_t> sizes_;
+    size_t componentCount_;
+
+    static bool valid(const std::vector<size_t> &parents, const std::vector<size_t> &sizes, uint64_t componentCount) {
+        size_t n = parents.size();
+        std::vector<size_t> roots(n);
+        std::vector<size_t> counts(n);
+        uint64_t rootCount = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (parents[v] > v) {
+                return false;
+            }
+            roots[v] = parents[v] == v ? v : roots[parents[v]];
+            ++counts[roots[v]];
+            if (roots[v] == v) {
+                ++rootCount;
+            }
+        }
+        for (size_t v = 0; v < n; ++v) {
+            if (roots[v] == v && sizes[v] != counts[v]) {
+                return false;
+            }
+        }
+        return rootCount == componentCount;
+    }
+};
+
+} // namespace graph
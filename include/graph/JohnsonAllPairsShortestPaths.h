@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "graph/BellmanFordShortestPaths.h"
+#include "graph/DefaultDigraph.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/SearchSpace.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/Empty.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+#include "graph/Matrix.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class JohnsonAllPairsShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    static constexpr size_t kNpos = -1;
+
+    JohnsonAllPairsShortestPaths(Graph &g,
+                                 Weights weights,
+                                 Matrix<Weight> *dists,
+                                 Matrix<size_t> *successors = nullptr)
+        : g_(g), weights_(std::move(weights)), dists_(dists), successors_(successors) {}
+
+    std::optional<std::vector<Vertex>> operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        std::vector<Weight> W = G.edgeValues(weights_);
+        size_t n = G.numVertices();
+
+        struct EdgeProps {
+            Weight weight;
+        };
+        DefaultDigraph<size_t, Empty, EdgeProps> augmented;
+        for (size_t v = 0; v <= n; ++v) {
+            augmented.addVertex(v);
+        }
+        for (size_t v = 0; v < n; ++v) {
+            augmented.addEdge(n, v, {0});
+        }
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            augmented.addEdge(G.source(e), G.target(e), {W[e]});
+        }
+        std::vector<Weight> h(n + 1);
+        std::vector<std::optional<size_t>> preds(n + 1);
+        std::vector<size_t> cycle =
+            BellmanFordShortestPaths(augmented, n, augmented[&EdgeProps::weight], &h, &preds)();
+        if (!cycle.empty()) {
+            return std::nullopt;
+        }
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            W[e] = W[e] + h[G.source(e)] - h[G.target(e)];
+        }
+
+        dists_->assign(n, n, Infinity());
+        if (successors_ != nullptr) {
+            successors_->assign(n, n, kNpos);
+        }
+        size_t threads = detail::threadCount();
+        std::vector<detail::SearchSpace<Weight>> searches(threads, detail::SearchSpace<Weight>(n));
+        std::vector<std::vector<size_t>> firsts(threads, std::vector<size_t>(n));
+        detail::parallelFor(0, n, [&](size_t thread, size_t s) {
+            detail::SearchSpace<Weight> &search = searches[thread];
+            std::vector<size_t> &first = firsts[thread];
+            Weight *row = dists_->row(s);
+            size_t *successors = successors_ != nullptr ? successors_->row(s) : nullptr;
+            search.clear();
+            search.relax(s, 0, kNpos);
+            while (!search.empty()) {
+                size_t u = search.pop();
+                row[u] = search.dist(u) - h[s] + h[u];
+                if (successors != nullptr) {
+                    size_t parent = u == s ? kNpos : G.source(search.pred(u));
+                    first[u] = parent == kNpos ? u : parent == s ? u : first[parent];
+                    successors[u] = first[u];
+                }
+                for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                    search.relax(G.target(e), search.dist(u) + W[e], e);
+                }
+            }
+        }, 1);
+
+        std::vector<Vertex> vertices;
+        for (size_t v = 0; v < n; ++v) {
+            vertices.push_back(G.vertex(v));
+        }
+        return vertices;
+    }
+
+private:
+    Graph &g_;
+    Weights weights_;
+    Matrix<Weight> *dists_;
+    Matrix<size_t> *successors_;
+};
+
+} // namespace graph
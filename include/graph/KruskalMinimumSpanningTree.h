@@ -1,11 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "graph/GeneralizedMaps.h"
 #include "graph/detail/DisjointSets.h"
+#include "graph/detail/IndexedGraph.h"
 
 namespace graph {
 
@@ -20,27 +23,16 @@ public:
         : g_(g), weights_(std::move(weights)), mstEdges_(std::move(mstEdges)) {}
     
     void operator()() {
-        std::vector<Edge> edges;
-        for (Vertex u : g_.vertices()) {
-            for (Edge e : g_.outEdges(u)) {
-                edges.push_back(e);
-            }
-        }
-        std::ranges::sort(edges, [this](Edge &lhs, Edge &rhs) {
-            return get(weights_, lhs) < get(weights_, rhs);
+        detail::IndexedGraph<Graph> g(g_);
+        std::vector<Weight> weights = g.edgeValues(weights_);
+        std::vector<size_t> edges(g.numEdges());
+        std::iota(edges.begin(), edges.end(), 0);
+        std::ranges::sort(edges, [&weights](size_t lhs, size_t rhs) {
+            return weights[lhs] < weights[rhs];
         });
-        detail::DisjointSets<Vertex> D;
-        for (Vertex v : g_.vertices()) {
-            D.makeSet(v);
-        }
-        for (Edge e : edges) {
-            put(mstEdges_, e, false);
-        }
-        for (Edge e : edges) {
-            if (D.find(g_.source(e)) != D.find(g_.target(e))) {
-                D.union_(g_.source(e), g_.target(e));
-                put(mstEdges_, e, true);
-            }
+        detail::DisjointSets D(g.numVertices());
+        for (size_t e : edges) {
+            put(mstEdges_, g.edge(e), D.union_(g.source(e), g.target(e)));
         }
     }
 
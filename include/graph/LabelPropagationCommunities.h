@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/atomic.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Communities>
+class LabelPropagationCommunities {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    LabelPropagationCommunities(Graph &g, Communities communities, size_t maxIterations = 100)
+        : g_(g), communities_(std::move(communities)), maxIterations_(maxIterations) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        G.buildInEdges();
+        size_t n = G.numVertices();
+        std::vector<size_t> labels(n);
+        for (size_t v = 0; v < n; ++v) {
+            labels[v] = v;
+        }
+
+        struct Scratch {
+            std::vector<size_t> counts;
+            std::vector<size_t> touched;
+        };
+        std::vector<Scratch> scratches(detail::threadCount());
+        for (size_t iteration = 0; iteration < maxIterations_; ++iteration) {
+            std::atomic<size_t> changes = 0;
+            detail::parallelFor(0, n, [&](size_t thread, size_t v) {
+                Scratch &S = scratches[thread];
+                if (S.counts.empty()) {
+                    S.counts.assign(n, 0);
+                }
+                auto count = [&](size_t w) {
+                    if (w != v) {
+                        size_t l = detail::atomicLoad(labels[w]);
+                        if (S.counts[l]++ == 0) {
+                            S.touched.push_back(l);
+                        }
+                    }
+                };
+                for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                    count(G.target(e));
+                }
+                for (size_t i = G.inBegin(v); i < G.inEnd(v); ++i) {
+                    count(G.source(G.inEdge(i)));
+                }
+                if (S.touched.empty()) {
+                    return;
+                }
+                size_t current = labels[v];
+                size_t best = current;
+                size_t bestCount = S.counts[current];
+                for (size_t l : S.touched) {
+                    if (S.counts[l] > bestCount || (S.counts[l] == bestCount && best != current && l < best)) {
+                        best = l;
+                        bestCount = S.counts[l];
+                    }
+                }
+                for (size_t l : S.touched) {
+                    S.counts[l] = 0;
+                }
+                S.touched.clear();
+                if (best != current) {
+                    detail::atomicStore(labels[v], best);
+                    changes.fetch_add(1, std::memory_order_relaxed);
+                }
+            }, 64);
+            if (changes.load() == 0) {
+                break;
+            }
+        }
+
+        std::vector<size_t> numbers(n, kNpos);
+        size_t communityCount = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (numbers[labels[v]] == kNpos) {
+                numbers[labels[v]] = communityCount++;
+            }
+            put(communities_, G.vertex(v), numbers[labels[v]]);
+        }
+        return communityCount;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    Graph &g_;
+    Communities communities_;
+    size_t maxIterations_;
+};
+
+} // namespace graph
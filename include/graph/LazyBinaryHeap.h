@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+template <typename Key, typename Priority>
+class LazyBinaryHeap {
+public:
+    bool empty() const {
+        return heap_.empty();
+    }
+
+    void push(Key key, Priority priority) {
+        heap_.push({std::move(priority), std::move(key)});
+    }
+
+    void decrease(Key key, Priority, Priority newPriority) {
+        heap_.push({std::move(newPriority), std::move(key)});
+    }
+
+    std::pair<Priority, Key> pop() {
+        std::pair<Priority, Key> top = heap_.top();
+        heap_.pop();
+        return top;
+    }
+
+private:
+    struct Greater {
+        bool operator()(const std::pair<Priority, Key> &lhs, const std::pair<Priority, Key> &rhs) const {
+            return rhs.first < lhs.first;
+        }
+    };
+
+    std::priority_queue<std::pair<Priority, Key>, std::vector<std::pair<Priority, Key>>, Greater> heap_;
+};
+
+} // namespace graph
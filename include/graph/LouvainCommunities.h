@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/atomic.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights, typename Communities>
+class LouvainCommunities {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    LouvainCommunities(Graph &g, Weights weights, Communities communities, double resolution = 1,
+                       double tolerance = 1e-6)
+        : g_(g),
+          weights_(std::move(weights)),
+          communities_(std::move(communities)),
+          resolution_(resolution),
+          tolerance_(tolerance) {}
+
+    double operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        Level L = symmetrize(G, G.edgeValues(weights_));
+        std::vector<size_t> memberships(n);
+        for (size_t v = 0; v < n; ++v) {
+            memberships[v] = v;
+        }
+
+        double modularity = 0;
+        if (L.total > 0) {
+            std::vector<size_t> C(n);
+            for (size_t v = 0; v < n; ++v) {
+                C[v] = v;
+            }
+            modularity = modularityOf(L, C);
+            while (true) {
+                for (size_t v = 0; v < L.size(); ++v) {
+                    C[v] = v;
+                }
+                double q = moveVertices(L, C, modularity);
+                if (q - modularity <= tolerance_) {
+                    break;
+                }
+                modularity = q;
+                size_t communityCount = renumber(C);
+                for (size_t v = 0; v < n; ++v) {
+                    memberships[v] = C[memberships[v]];
+                }
+                if (communityCount == L.size()) {
+                    break;
+                }
+                L = aggregate(L, C, communityCount);
+                C.resize(communityCount);
+            }
+        }
+
+        for (size_t v = 0; v < n; ++v) {
+            put(communities_, G.vertex(v), memberships[v]);
+        }
+        return modularity;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+    static constexpr size_t kMaxPasses = 100;
+    static constexpr size_t kBlockSize = 1024;
+
+    struct Level {
+        std::vector<size_t> offsets;
+        std::vector<size_t> targets;
+        std::vector<double> weights;
+        std::vector<double> degrees;
+        double total = 0;
+
+        size_t size() const {
+            return degrees.size();
+        }
+    };
+
+    struct Scratch {
+        std::vector<double> sums;
+        std::vector<size_t> touched;
+    };
+
+    Graph &g_;
+    Weights weights_;
+    Communities communities_;
+    double resolution_;
+    double tolerance_;
+
+    template <typename W>
+    static Level symmetrize(const detail::IndexedGraph<Graph> &G, const std::vector<W> &edgeWeights) {
+        size_t n = G.numVertices();
+        Level L;
+        L.offsets.assign(n + 1, 0);
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            ++L.offsets[G.source(e) + 1];
+            ++L.offsets[G.target(e) + 1];
+        }
+        for (size_t v = 0; v < n; ++v) {
+            L.offsets[v + 1] += L.offsets[v];
+        }
+        L.targets.resize(L.offsets[n]);
+        L.weights.resize(L.offsets[n]);
+        L.degrees.assign(n, 0);
+        std::vector<size_t> next(L.offsets.begin(), L.offsets.end() - 1);
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            size_t u = G.source(e);
+            size_t v = G.target(e);
+            double w = static_cast<double>(edgeWeights[e]);
+            L.targets[next[u]] = v;
+            L.weights[next[u]++] = w;
+            L.targets[next[v]] = u;
+            L.weights[next[v]++] = w;
+            L.degrees[u] += w;
+            L.degrees[v] += w;
+            L.total += 2 * w;
+        }
+        return L;
+    }
+
+    double modularityOf(const Level &L, const std::vector<size_t> &C) const {
+        size_t n = L.size();
+        size_t blockCount = (n + kBlockSize - 1) / kBlockSize;
+        std::vector<double> internals(blockCount);
+        detail::parallelFor(0, blockCount, [&](size_t b) {
+            double internal = 0;
+            for (size_t v = b * kBlockSize; v < std::min((b + 1) * kBlockSize, n); ++v) {
+                for (size_t i = L.offsets[v]; i < L.offsets[v + 1]; ++i) {
+                    internal += C[L.targets[i]] == C[v] ? L.weights[i] : 0;
+                }
+            }
+            internals[b] = internal;
+        }, 1);
+        std::vector<double> totals(n);
+        for (size_t v = 0; v < n; ++v) {
+            totals[C[v]] += L.degrees[v];
+        }
+        double internal = 0;
+        for (double x : internals) {
+            internal += x;
+        }
+        double expected = 0;
+        for (double t : totals) {
+            expected += t * t;
+        }
+        return internal / L.total - resolution_ * expected / (L.total * L.total);
+    }
+
+    double moveVertices(const Level &L, std::vector<size_t> &C, double modularity) const {
+        size_t n = L.size();
+        std::vector<double> totals(L.degrees);
+        std::vector<size_t> sizes(n, 1);
+        std::vector<Scratch> scratches(detail::threadCount());
+        for (size_t pass = 0; pass < kMaxPasses; ++pass) {
+            std::atomic<size_t> moves = 0;
+            detail::parallelFor(0, n, [&](size_t thread, size_t v) {
+                Scratch &S = scratches[thread];
+                if (S.sums.empty()) {
+                    S.sums.assign(n, 0);
+                }
+                for (size_t i = L.offsets[v]; i < L.offsets[v + 1]; ++i) {
+                    if (L.targets[i] != v) {
+                        size_t c = detail::atomicLoad(C[L.targets[i]]);
+                        if (S.sums[c] == 0) {
+                            S.touched.push_back(c);
+                        }
+                        S.sums[c] += L.weights[i];
+                    }
+                }
+                size_t current = C[v];
+                double k = L.degrees[v];
+                double scale = resolution_ * k / L.total;
+                size_t best = current;
+                double bestGain = S.sums[current] - scale * (detail::atomicLoad(totals[current]) - k);
+                for (size_t c : S.touched) {
+                    double gain = S.sums[c] - scale * detail::atomicLoad(totals[c]);
+                    if (c != current && (gain > bestGain || (gain == bestGain && best != current && c < best))) {
+                        best = c;
+                        bestGain = gain;
+                    }
+                }
+                for (size_t c : S.touched) {
+                    S.sums[c] = 0;
+                }
+                S.touched.clear();
+                if (best == current || (best > current && detail::atomicLoad(sizes[current]) == 1 &&
+                                        detail::atomicLoad(sizes[best]) == 1)) {
+                    return;
+                }
+                std::atomic_ref<double>(totals[current]).fetch_sub(k, std::memory_order_relaxed);
+                std::atomic_ref<double>(totals[best]).fetch_add(k, std::memory_order_relaxed);
+                std::atomic_ref<size_t>(sizes[current]).fetch_sub(1, std::memory_order_relaxed);
+                std::atomic_ref<size_t>(sizes[best]).fetch_add(1, std::memory_order_relaxed);
+                detail::atomicStore(C[v], best);
+                moves.fetch_add(1, std::memory_order_relaxed);
+            }, 64);
+            if (moves.load() == 0) {
+                break;
+            }
+            double q = modularityOf(L, C);
+            bool converged = q - modularity <= tolerance_;
+            modularity = q;
+            if (converged) {
+                break;
+            }
+        }
+        return modularity;
+    }
+
+    static size_t renumber(std::vector<size_t> &C) {
+        std::vector<size_t> numbers(C.size(), kNpos);
+        size_t count = 0;
+        for (size_t &c : C) {
+            if (numbers[c] == kNpos) {
+                numbers[c] = count++;
+            }
+            c = numbers[c];
+        }
+        return count;
+    }
+
+    static Level aggregate(const Level &L, const std::vector<size_t> &C, size_t communityCount) {
+        size_t n = L.size();
+        std::vector<size_t> memberOffsets(communityCount + 1);
+        for (size_t v = 0; v < n; ++v) {
+            ++memberOffsets[C[v] + 1];
+        }
+        for (size_t c = 0; c < communityCount; ++c) {
+            memberOffsets[c + 1] += memberOffsets[c];
+        }
+        std::vector<size_t> members(n);
+        std::vector<size_t> next(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (size_t v = 0; v < n; ++v) {
+            members[next[C[v]]++] = v;
+        }
+
+        std::vector<std::vector<std::pair<size_t, double>>> rows(communityCount);
+        std::vector<Scratch> scratches(detail::threadCount());
+        detail::parallelFor(0, communityCount, [&](size_t thread, size_t c) {
+            Scratch &S = scratches[thread];
+            if (S.sums.empty()) {
+                S.sums.assign(communityCount, 0);
+            }
+            for (size_t j = memberOffsets[c]; j < memberOffsets[c + 1]; ++j) {
+                size_t v = members[j];
+                for (size_t i = L.offsets[v]; i < L.offsets[v + 1]; ++i) {
+                    size_t d = C[L.targets[i]];
+                    if (S.sums[d] == 0) {
+                        S.touched.push_back(d);
+                    }
+                    S.sums[d] += L.weights[i];
+                }
+            }
+            for (size_t d : S.touched) {
+                rows[c].emplace_back(d, S.sums[d]);
+                S.sums[d] = 0;
+            }
+            S.touched.clear();
+        }, 64);
+
+        Level coarse;
+        coarse.offsets.assign(communityCount + 1, 0);
+        coarse.degrees.assign(communityCount, 0);
+        coarse.total = L.total;
+        for (size_t c = 0; c < communityCount; ++c) {
+            coarse.offsets[c + 1] = coarse.offsets[c] + rows[c].size();
+        }
+        coarse.targets.resize(coarse.offsets[communityCount]);
+        coarse.weights.resize(coarse.offsets[communityCount]);
+        detail::parallelFor(0, communityCount, [&](size_t c) {
+            size_t i = coarse.offsets[c];
+            for (auto [d, w] : rows[c]) {
+                coarse.targets[i] = d;
+                coarse.weights[i++] = w;
+                coarse.degrees[c] += w;
+            }
+        });
+        return coarse;
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/SearchSpace.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+#include "graph/Matrix.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class ManyToManyShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    ManyToManyShortestPaths(Graph &g,
+                            Weights weights,
+                            std::vector<Vertex> sources,
+                            std::vector<Vertex> targets,
+                            Matrix<Weight> *dists)
+        : g_(g),
+          weights_(std::move(weights)),
+          sources_(std::move(sources)),
+          targets_(std::move(targets)),
+          dists_(dists) {}
+
+    void operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        std::vector<Weight> W = G.edgeValues(weights_);
+        size_t n = G.numVertices();
+        std::vector<size_t> slots(n, kNpos);
+        std::vector<size_t> columns;
+        std::vector<size_t> unique;
+        for (Vertex t : targets_) {
+            size_t v = G.index(t);
+            if (slots[v] == kNpos) {
+                slots[v] = unique.size();
+                unique.push_back(v);
+            }
+            columns.push_back(slots[v]);
+        }
+        dists_->assign(sources_.size(), targets_.size(), Infinity());
+        std::vector<detail::SearchSpace<Weight>> searches(detail::threadCount(), detail::SearchSpace<Weight>(n));
+        std::vector<std::vector<Weight>> found(detail::threadCount(), std::vector<Weight>(unique.size()));
+        detail::parallelFor(0, sources_.size(), [&](size_t thread, size_t i) {
+            detail::SearchSpace<Weight> &search = searches[thread];
+            std::vector<Weight> &local = found[thread];
+            std::ranges::fill(local, kInfinity<Weight>);
+            size_t remaining = unique.size();
+            search.clear();
+            search.relax(G.index(sources_[i]), 0, kNpos);
+            while (!search.empty() && remaining > 0) {
+                size_t u = search.pop();
+                if (slots[u] != kNpos) {
+                    local[slots[u]] = search.dist(u);
+                    --remaining;
+                }
+                for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                    search.relax(G.target(e), search.dist(u) + W[e], e);
+                }
+            }
+            Weight *row = dists_->row(i);
+            for (size_t j = 0; j < columns.size(); ++j) {
+                row[j] = local[columns[j]];
+            }
+        }, 1);
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    Graph &g_;
+    Weights weights_;
+    std::vector<Vertex> sources_;
+    std::vector<Vertex> targets_;
+    Matrix<Weight> *dists_;
+};
+
+} // namespace graph
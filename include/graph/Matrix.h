@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace graph {
+
+template <typename T>
+class Matrix {
+public:
+    Matrix() = default;
+
+    Matrix(size_t rows, size_t cols, T value = {}) : rows_(rows), cols_(cols), data_(rows * cols, std::move(value)) {}
+
+    size_t rows() const {
+        return rows_;
+    }
+
+    size_t cols() const {
+        return cols_;
+    }
+
+    T &operator()(size_t i, size_t j) {
+        return data_[i * cols_ + j];
+    }
+
+    const T &operator()(size_t i, size_t j) const {
+        return data_[i * cols_ + j];
+    }
+
+    T *row(size_t i) {
+        return data_.data() + i * cols_;
+    }
+
+    const T *row(size_t i) const {
+        return data_.data() + i * cols_;
+    }
+
+    T *data() {
+        return data_.data();
+    }
+
+    const T *data() const {
+        return data_.data();
+    }
+
+    void assign(size_t rows, size_t cols, T value) {
+        rows_ = rows;
+        cols_ = cols;
+        data_.assign(rows * cols, std::move(value));
+    }
+
+private:
+    size_t rows_{};
+    size_t cols_{};
+    std::vector<T> data_;
+};
+
+} // namespace graph
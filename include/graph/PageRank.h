@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Ranks>
+class PageRank {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Rank = GeneralizedMapTraits<Ranks>::Value;
+
+public:
+    PageRank(Graph &g, Ranks ranks, Rank damping = 0.85, Rank tolerance = 1e-6, size_t maxIterations = 100)
+        : g_(g),
+          ranks_(std::move(ranks)),
+          damping_(damping),
+          tolerance_(tolerance),
+          maxIterations_(maxIterations) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        G.buildInEdges();
+        size_t n = G.numVertices();
+        size_t m = G.numEdges();
+        if (n == 0) {
+            return 0;
+        }
+        std::vector<size_t> sources(m);
+        for (size_t i = 0; i < m; ++i) {
+            sources[i] = G.source(G.inEdge(i));
+        }
+        std::vector<Rank> scales(n);
+        for (size_t u = 0; u < n; ++u) {
+            scales[u] = G.outDegree(u) == 0 ? 0 : 1 / static_cast<Rank>(G.outDegree(u));
+        }
+
+        std::vector<Rank> R(n, 1 / static_cast<Rank>(n));
+        std::vector<Rank> contributions(n);
+        size_t blockCount = (n + kBlockSize - 1) / kBlockSize;
+        std::vector<Rank> danglings(blockCount);
+        std::vector<Rank> errors(blockCount);
+        size_t iteration = 0;
+        while (iteration < maxIterations_) {
+            ++iteration;
+            detail::parallelFor(0, blockCount, [&](size_t b) {
+                size_t lo = b * kBlockSize;
+                size_t hi = std::min(lo + kBlockSize, n);
+                Rank dangling = 0;
+                for (size_t u = lo; u < hi; ++u) {
+                    contributions[u] = R[u] * scales[u];
+                    dangling += scales[u] == 0 ? R[u] : 0;
+                }
+                danglings[b] = dangling;
+            }, 1);
+            Rank dangling = 0;
+            for (Rank d : danglings) {
+                dangling += d;
+            }
+            Rank base = (1 - damping_ + damping_ * dangling) / static_cast<Rank>(n);
+            detail::parallelFor(0, blockCount, [&](size_t b) {
+                size_t lo = b * kBlockSize;
+                size_t hi = std::min(lo + kBlockSize, n);
+                Rank error = 0;
+                for (size_t v = lo; v < hi; ++v) {
+                    Rank sum = 0;
+                    for (size_t i = G.inBegin(v); i < G.inEnd(v); ++i) {
+                        sum += contributions[sources[i]];
+                    }
+                    Rank rank = base + damping_ * sum;
+                    error += std::abs(rank - R[v]);
+                    R[v] = rank;
+                }
+                errors[b] = error;
+            }, 1);
+            Rank error = 0;
+            for (Rank e : errors) {
+                error += e;
+            }
+            if (error < tolerance_) {
+                break;
+            }
+        }
+
+        for (size_t v = 0; v < n; ++v) {
+            put(ranks_, G.vertex(v), R[v]);
+        }
+        return iteration;
+    }
+
+private:
+    static constexpr size_t kBlockSize = 1024;
+
+    Graph &g_;
+    Ranks ranks_;
+    Rank damping_;
+    Rank tolerance_;
+    size_t maxIterations_;
+};
+
+} // namespace graph
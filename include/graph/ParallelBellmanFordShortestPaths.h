@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+#include "graph/Infinity.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights, typename Dists, typename Preds>
+class ParallelBellmanFordShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    ParallelBellmanFordShortestPaths(Graph &g, Vertex s, Weights weights, Dists dists, Preds preds)
+        : g_(g),
+          s_(s),
+          weights_(std::move(weights)),
+          dists_(std::move(dists)),
+          preds_(std::move(preds)) {}
+
+    std::vector<Vertex> operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        G.buildInEdges();
+        std::vector<Weight> edgeWeights = G.edgeValues(weights_);
+        size_t n = G.numVertices();
+        size_t m = G.numEdges();
+        std::vector<size_t> sources(m);
+        std::vector<Weight> weights(m);
+        for (size_t i = 0; i < m; ++i) {
+            sources[i] = G.source(G.inEdge(i));
+            weights[i] = edgeWeights[G.inEdge(i)];
+        }
+
+        std::vector<Weight> D(n, kInfinity<Weight>);
+        std::vector<Weight> next(n);
+        std::vector<size_t> P(n, kNpos);
+        size_t si = G.index(s_);
+        D[si] = 0;
+        std::vector<Vertex> cycle;
+        for (size_t round = 1;; ++round) {
+            std::atomic<bool> changed = false;
+            detail::parallelFor(0, n, [&](size_t v) {
+                Weight best = D[v];
+                for (size_t i = G.inBegin(v); i < G.inEnd(v); ++i) {
+                    Weight d = D[sources[i]] == kInfinity<Weight> ? kInfinity<Weight> : D[sources[i]] + weights[i];
+                    best = d < best ? d : best;
+                }
+                if (best < D[v]) {
+                    for (size_t i = G.inBegin(v); i < G.inEnd(v); ++i) {
+                        if (D[sources[i]] != kInfinity<Weight> && D[sources[i]] + weights[i] == best) {
+                            P[v] = G.inEdge(i);
+                            break;
+                        }
+                    }
+                    changed.store(true, std::memory_order_relaxed);
+                }
+                next[v] = best;
+            });
+            D.swap(next);
+            if (!changed.load()) {
+                break;
+            }
+            if (round >= n) {
+                cycle = findCycle(G, P);
+                if (!cycle.empty()) {
+                    break;
+                }
+            }
+        }
+
+        for (size_t v = 0; v < n; ++v) {
+            Vertex x = G.vertex(v);
+            put(dists_, x, D[v]);
+            if (P[v] == kNpos) {
+                put(preds_, x, std::nullopt);
+            } else {
+                put(preds_, x, G.vertex(G.source(P[v])));
+            }
+        }
+        return cycle;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    Graph &g_;
+    Vertex s_;
+    Weights weights_;
+    Dists dists_;
+    Preds preds_;
+
+    static std::vector<Vertex> findCycle(const detail::IndexedGraph<Graph> &G, const std::vector<size_t> &P) {
+        size_t n = G.numVertices();
+        std::vector<size_t> marks(n, kNpos);
+        for (size_t v = 0; v < n; ++v) {
+            size_t u = v;
+            while (u != kNpos && marks[u] == kNpos) {
+                marks[u] = v;
+                u = P[u] == kNpos ? kNpos : G.source(P[u]);
+            }
+            if (u != kNpos && marks[u] == v) {
+                std::vector<Vertex> cycle;
+                size_t x = u;
+                do {
+                    cycle.push_back(G.vertex(x));
+                    x = G.source(P[x]);
+                } while (x != u);
+                std::ranges::reverse(cycle);
+                return cycle;
+            }
+        }
+        return {};
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename CoreNumbers>
+class ParallelCoreDecomposition {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    ParallelCoreDecomposition(Graph &g, CoreNumbers coreNumbers) : g_(g), coreNumbers_(std::move(coreNumbers)) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        std::vector<size_t> degrees(n);
+        detail::parallelFor(0, n, [&](size_t v) {
+            for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                degrees[v] += G.target(e) != v;
+            }
+        });
+
+        std::vector<uint8_t> removed(n);
+        std::vector<size_t> remaining(n);
+        for (size_t v = 0; v < n; ++v) {
+            remaining[v] = v;
+        }
+        std::vector<std::vector<size_t>> next(detail::threadCount());
+        std::vector<size_t> frontier;
+        size_t k = 0;
+        while (!remaining.empty()) {
+            frontier.clear();
+            size_t kept = 0;
+            for (size_t v : remaining) {
+                if (removed[v]) {
+                    continue;
+                }
+                if (degrees[v] <= k) {
+                    frontier.push_back(v);
+                } else {
+                    remaining[kept++] = v;
+                }
+            }
+            remaining.resize(kept);
+            while (!frontier.empty()) {
+                detail::parallelFor(0, frontier.size(), [&](size_t i) {
+                    removed[frontier[i]] = true;
+                });
+                detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t i) {
+                    size_t v = frontier[i];
+                    for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                        size_t w = G.target(e);
+                        if (w != v && !removed[w] &&
+                            std::atomic_ref<size_t>(degrees[w]).fetch_sub(1, std::memory_order_relaxed) == k + 1) {
+                            next[thread].push_back(w);
+                        }
+                    }
+                }, 64);
+                for (size_t v : frontier) {
+                    degrees[v] = k;
+                }
+                frontier.clear();
+                for (std::vector<size_t> &local : next) {
+                    frontier.insert(frontier.end(), local.begin(), local.end());
+                    local.clear();
+                }
+            }
+            if (!remaining.empty()) {
+                ++k;
+            }
+        }
+
+        size_t degeneracy = 0;
+        for (size_t v = 0; v < n; ++v) {
+            put(coreNumbers_, G.vertex(v), degrees[v]);
+            degeneracy = std::max(degeneracy, degrees[v]);
+        }
+        return degeneracy;
+    }
+
+private:
+    Graph &g_;
+    CoreNumbers coreNumbers_;
+};
+
+} // namespace graph
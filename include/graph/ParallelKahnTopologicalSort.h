@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph>
+class ParallelKahnTopologicalSort {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    explicit ParallelKahnTopologicalSort(Graph &g) : g_(g) {}
+
+    std::optional<std::vector<std::vector<Vertex>>> operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        std::vector<size_t> in(n);
+        detail::parallelFor(0, n, [&](size_t u) {
+            for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                std::atomic_ref<size_t>(in[G.target(e)]).fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+
+        std::vector<size_t> frontier;
+        for (size_t v = 0; v < n; ++v) {
+            if (in[v] == 0) {
+                frontier.push_back(v);
+            }
+        }
+        std::vector<std::vector<size_t>> next(detail::threadCount());
+        std::vector<std::vector<Vertex>> levels;
+        size_t sortedCount = 0;
+        while (!frontier.empty()) {
+            std::vector<Vertex> &level = levels.emplace_back(frontier.size());
+            detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t i) {
+                size_t u = frontier[i];
+                level[i] = G.vertex(u);
+                for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                    size_t v = G.target(e);
+                    if (std::atomic_ref<size_t>(in[v]).fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        next[thread].push_back(v);
+                    }
+                }
+            }, 64);
+            sortedCount += frontier.size();
+            frontier.clear();
+            for (std::vector<size_t> &local : next) {
+                frontier.insert(frontier.end(), local.begin(), local.end());
+                local.clear();
+            }
+        }
+        if (sortedCount != n) {
+            return std::nullopt;
+        }
+        return levels;
+    }
+
+private:
+    Graph &g_;
+};
+
+} // namespace graph
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "graph/GeneralizedMaps.h"
+#include "graph/KahnTopologicalSort.h"
+
+namespace graph {
+
+template <typename Graph>
+class PearceKellyTopologicalOrder {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+    template <typename V>
+    using VertexMap = Graph::template VertexMap<V>;
+
+public:
+    explicit PearceKellyTopologicalOrder(Graph &g) : g_(g), order_(KahnTopologicalSort(g)()) {
+        if (order_.size() != g_.numVertices()) {
+            throw std::invalid_argument("PearceKellyTopologicalOrder: graph has a cycle");
+        }
+        for (size_t i = 0; i < order_.size(); ++i) {
+            put(positions_, order_[i], i);
+            put(in_, order_[i], {});
+            put(visited_, order_[i], false);
+        }
+        for (Vertex u : order_) {
+            for (Edge e : g_.outEdges(u)) {
+                get(in_, g_.target(e)).push_back(u);
+            }
+        }
+    }
+
+    const std::vector<Vertex> &order() const {
+        return order_;
+    }
+
+    size_t position(Vertex v) const {
+        return get(positions_, v);
+    }
+
+    void insertVertex(Vertex v) {
+        put(positions_, v, order_.size());
+        put(in_, v, {});
+        put(visited_, v, false);
+        order_.push_back(v);
+    }
+
+    bool insertEdge(Vertex u, Vertex v) {
+        if (u == v) {
+            return false;
+        }
+        size_t lower = get(positions_, v);
+        size_t upper = get(positions_, u);
+        if (lower < upper) {
+            std::vector<Vertex> forward;
+            std::vector<Vertex> backward;
+            bool acyclic = search(v, upper, forward);
+            if (acyclic) {
+                searchBackward(u, lower, backward);
+            }
+            for (Vertex x : forward) {
+                put(visited_, x, false);
+            }
+            for (Vertex x : backward) {
+                put(visited_, x, false);
+            }
+            if (!acyclic) {
+                return false;
+            }
+            reorder(forward, backward);
+        }
+        get(in_, v).push_back(u);
+        return true;
+    }
+
+    void removeEdge(Vertex u, Vertex v) {
+        std::vector<Vertex> &in = get(in_, v);
+        auto it = std::ranges::find(in, u);
+        if (it != in.end()) {
+            *it = in.back();
+            in.pop_back();
+        }
+    }
+
+private:
+    Graph &g_;
+    std::vector<Vertex> order_;
+    VertexMap<size_t> positions_;
+    VertexMap<std::vector<Vertex>> in_;
+    VertexMap<bool> visited_;
+
+    bool search(Vertex s, size_t upper, std::vector<Vertex> &region) {
+        std::vector<Vertex> stack{s};
+        put(visited_, s, true);
+        region.push_back(s);
+        while (!stack.empty()) {
+            Vertex x = stack.back();
+            stack.pop_back();
+            for (Edge e : g_.outEdges(x)) {
+                Vertex y = g_.target(e);
+                size_t p = get(positions_, y);
+                if (p == upper) {
+                    return false;
+                }
+                if (p < upper && !get(visited_, y)) {
+                    put(visited_, y, true);
+                    region.push_back(y);
+                    stack.push_back(y);
+                }
+            }
+        }
+        return true;
+    }
+
+    void searchBackward(Vertex s, size_t lower, std::vector<Vertex> &region) {
+        std::vector<Vertex> stack{s};
+        put(visited_, s, true);
+        region.push_back(s);
+        while (!stack.empty()) {
+            Vertex x = stack.back();
+            stack.pop_back();
+            for (Vertex y : get(in_, x)) {
+                if (get(positions_, y) > lower && !get(visited_, y)) {
+                    put(visited_, y, true);
+                    region.push_back(y);
+                    stack.push_back(y);
+                }
+            }
+        }
+    }
+
+    void reorder(std::vector<Vertex> &forward, std::vector<Vertex> &backward) {
+        auto byPosition = [this](Vertex lhs, Vertex rhs) {
+            return get(positions_, lhs) < get(positions_, rhs);
+        };
+        std::ranges::sort(forward, byPosition);
+        std::ranges::sort(backward, byPosition);
+        std::vector<size_t> slots;
+        slots.reserve(forward.size() + backward.size());
+        for (Vertex x : backward) {
+            slots.push_back(get(positions_, x));
+        }
+        for (Vertex x : forward) {
+            slots.push_back(get(positions_, x));
+        }
+        std::ranges::sort(slots);
+        size_t i = 0;
+        for (Vertex x : backward) {
+            put(positions_, x, slots[i]);
+            order_[slots[i++]] = x;
+        }
+        for (Vertex x : forward) {
+            put(positions_, x, slots[i]);
+            order_[slots[i++]] = x;
+        }
+    }
+};
+
+} // namespace graph
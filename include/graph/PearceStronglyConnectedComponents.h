@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename SccNumbers>
+class PearceStronglyConnectedComponents {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using OutEdgeIterator = std::ranges::iterator_t<decltype(std::declval<Graph &>().outEdges(std::declval<Vertex>()))>;
+
+public:
+    PearceStronglyConnectedComponents(Graph &g, SccNumbers sccNumbers)
+        : g_(g), sccNumbers_(std::move(sccNumbers)) {}
+
+    size_t operator()() {
+        size_t n = 0;
+        for (Vertex v : g_.vertices()) {
+            put(sccNumbers_, v, 0);
+            ++n;
+        }
+        if (n == 0) {
+            return 0;
+        }
+        index_ = 1;
+        component_ = n - 1;
+        for (Vertex v : g_.vertices()) {
+            if (get(sccNumbers_, v) == 0) {
+                visit(v);
+            }
+        }
+        for (Vertex v : g_.vertices()) {
+            put(sccNumbers_, v, n - 1 - get(sccNumbers_, v));
+        }
+        return n - 1 - component_;
+    }
+
+private:
+    struct Frame {
+        Vertex v;
+        OutEdgeIterator it;
+        OutEdgeIterator end;
+        bool root;
+    };
+
+    Graph &g_;
+    SccNumbers sccNumbers_;
+    size_t index_{};
+    size_t component_{};
+    std::vector<Frame> frames_;
+    std::vector<Vertex> S_;
+
+    void begin(Vertex v) {
+        auto edges = g_.outEdges(v);
+        put(sccNumbers_, v, index_++);
+        frames_.push_back({v, std::ranges::begin(edges), std::ranges::end(edges), true});
+    }
+
+    void visit(Vertex s) {
+        begin(s);
+        while (!frames_.empty()) {
+            Frame &f = frames_.back();
+            if (f.it != f.end) {
+                Vertex w = g_.target(*f.it);
+                if (get(sccNumbers_, w) == 0) {
+                    begin(w);
+                    continue;
+                }
+                if (get(sccNumbers_, w) < get(sccNumbers_, f.v)) {
+                    put(sccNumbers_, f.v, get(sccNumbers_, w));
+                    f.root = false;
+                }
+                ++f.it;
+                continue;
+            }
+            Vertex v = f.v;
+            bool root = f.root;
+            frames_.pop_back();
+            if (root) {
+                --index_;
+                while (!S_.empty() && get(sccNumbers_, v) <= get(sccNumbers_, S_.back())) {
+                    put(sccNumbers_, S_.back(), component_);
+                    S_.pop_back();
+                    --index_;
+                }
+                put(sccNumbers_, v, component_);
+                --component_;
+            } else {
+                S_.push_back(v);
+            }
+        }
+    }
+};
+
+} // namespace graph
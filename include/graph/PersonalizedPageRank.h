@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Ranks>
+class PersonalizedPageRank {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Rank = GeneralizedMapTraits<Ranks>::Value;
+
+public:
+    PersonalizedPageRank(Graph &g, Vertex s, Ranks ranks, Rank damping = 0.85, Rank epsilon = 1e-6)
+        : g_(g), s_(s), ranks_(std::move(ranks)), damping_(damping), epsilon_(epsilon) {}
+
+    size_t operator()() {
+        std::unordered_map<Vertex, State> states;
+        std::queue<Vertex> Q;
+        size_t pushes = 0;
+        push(states, Q, s_, 1);
+        while (!Q.empty()) {
+            Vertex u = Q.front();
+            Q.pop();
+            ++pushes;
+            State &S = states[u];
+            Rank r = S.residual;
+            S.residual = 0;
+            S.queued = false;
+            S.estimate += (1 - damping_) * r;
+            size_t degree = g_.numOutEdges(u);
+            if (degree == 0) {
+                push(states, Q, s_, damping_ * r);
+                continue;
+            }
+            Rank share = damping_ * r / static_cast<Rank>(degree);
+            for (Edge e : g_.outEdges(u)) {
+                push(states, Q, g_.target(e), share);
+            }
+        }
+        for (const auto &[v, S] : states) {
+            if (S.estimate != 0) {
+                put(ranks_, v, S.estimate);
+            }
+        }
+        return pushes;
+    }
+
+private:
+    struct State {
+        Rank estimate = 0;
+        Rank residual = 0;
+        bool queued = false;
+    };
+
+    Graph &g_;
+    Vertex s_;
+    Ranks ranks_;
+    Rank damping_;
+    Rank epsilon_;
+
+    void push(std::unordered_map<Vertex, State> &states, std::queue<Vertex> &Q, Vertex v, Rank mass) {
+        State &S = states[v];
+        S.residual += mass;
+        if (!S.queued && S.residual > epsilon_ * static_cast<Rank>(std::max<size_t>(g_.numOutEdges(v), 1))) {
+            S.queued = true;
+            Q.push(v);
+        }
+    }
+};
+
+} // namespace graph
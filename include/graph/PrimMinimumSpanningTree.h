@@ -1,16 +1,25 @@
 #pragma once
 
 #include <optional>
-#include <set>
 #include <utility>
 
+#include "graph/detail/MonotonePriorityQueue.h"
 #include "graph/GeneralizedMaps.h"
 #include "graph/Infinity.h"
+#include "graph/SetPriorityQueue.h"
 
 namespace graph {
 
-template <typename Graph, typename Weights, typename Dists, typename Preds>
+template <typename Graph,
+          typename Weights,
+          typename Dists,
+          typename Preds,
+          typename PriorityQueue = SetPriorityQueue<typename Graph::Vertex,
+                                                    typename GeneralizedMapTraits<Weights>::Value>>
 class PrimMinimumSpanningTree {
+    static_assert(!detail::MonotonePriorityQueue<PriorityQueue>,
+                  "PrimMinimumSpanningTree: keys are not monotone, so monotone priority queues are not supported");
+
     using Vertex = Graph::Vertex;
     using Edge = Graph::Edge;
     using Weight = GeneralizedMapTraits<Weights>::Value;
@@ -19,8 +28,13 @@ class PrimMinimumSpanningTree {
     using VertexMap = Graph::template VertexMap<V>;
 
 public:
-    PrimMinimumSpanningTree(Graph &g, Vertex s, Weights weights, Dists dists, Preds preds)
-        : g_(g), s_(s), weights_(std::move(weights)), dists_(std::move(dists)), preds_(std::move(preds)) {}
+    PrimMinimumSpanningTree(Graph &g, Vertex s, Weights weights, Dists dists, Preds preds, PriorityQueue queue = {})
+        : g_(g),
+          s_(s),
+          weights_(std::move(weights)),
+          dists_(std::move(dists)),
+          preds_(std::move(preds)),
+          queue_(std::move(queue)) {}
     
     void operator()() {
         VertexMap<bool> used;
@@ -32,18 +46,25 @@ public:
         put(dists_, s_, 0);
         put(preds_, s_, std::nullopt);
         put(used, s_, false);
-        std::set<std::pair<Weight, Vertex>> U{{0, s_}};
-        while (!U.empty()) {
-            Vertex u = U.begin()->second;
-            U.erase(U.begin());
+        queue_.push(s_, 0);
+        while (!queue_.empty()) {
+            auto [d, u] = queue_.pop();
+            if (get(used, u) || get(dists_, u) < d) {
+                continue;
+            }
             put(used, u, true);
             for (Edge e : g_.outEdges(u)) {
                 Vertex v = g_.target(e);
                 Weight w = get(weights_, e);
                 if (!get(used, v) && get(dists_, v) > w) {
-                    U.erase({get(dists_, v), v});
+                    Weight old = get(dists_, v);
                     put(dists_, v, w);
-                    U.insert({get(dists_, v), v});
+                    put(preds_, v, u);
+                    if (old == Infinity()) {
+                        queue_.push(v, w);
+                    } else {
+                        queue_.decrease(v, old, w);
+                    }
                 }
             }
         }
@@ -55,6 +76,7 @@ private:
     Weights weights_;
     Dists dists_;
     Preds preds_;
+    PriorityQueue queue_;
 };
 
 } // namespace graph
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/MonotonePriorityQueue.h"
+
+namespace graph {
+
+template <typename Key, std::unsigned_integral Priority>
+class RadixHeap {
+public:
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    void push(Key key, Priority priority) {
+        buckets_[bucket(priority)].push_back({priority, std::move(key)});
+        ++size_;
+    }
+
+    void decrease(Key key, Priority, Priority newPriority) {
+        push(std::move(key), newPriority);
+    }
+
+    std::pair<Priority, Key> pop() {
+        if (buckets_[0].empty()) {
+            size_t i = 1;
+            while (buckets_[i].empty()) {
+                ++i;
+            }
+            last_ = buckets_[i].front().first;
+            for (const auto &item : buckets_[i]) {
+                if (item.first < last_) {
+                    last_ = item.first;
+                }
+            }
+            for (auto &item : buckets_[i]) {
+                buckets_[bucket(item.first)].push_back(std::move(item));
+            }
+            buckets_[i].clear();
+        }
+        std::pair<Priority, Key> top = std::move(buckets_[0].back());
+        buckets_[0].pop_back();
+        --size_;
+        return top;
+    }
+
+private:
+    std::array<std::vector<std::pair<Priority, Key>>, std::numeric_limits<Priority>::digits + 1> buckets_;
+    Priority last_{};
+    size_t size_{};
+
+    size_t bucket(Priority priority) const {
+        return std::bit_width(static_cast<Priority>(priority ^ last_));
+    }
+};
+
+namespace detail {
+
+template <typename Key, typename Priority>
+struct is_monotone_priority_queue_impl<RadixHeap<Key, Priority>> : std::true_type {};
+
+} // namespace detail
+
+} // namespace graph
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <set>
+#include <utility>
+
+namespace graph {
+
+template <typename Key, typename Priority>
+class SetPriorityQueue {
+public:
+    bool empty() const {
+        return set_.empty();
+    }
+
+    void push(Key key, Priority priority) {
+        set_.insert({std::move(priority), std::move(key)});
+    }
+
+    void decrease(Key key, Priority oldPriority, Priority newPriority) {
+        set_.erase({std::move(oldPriority), key});
+        set_.insert({std::move(newPriority), std::move(key)});
+    }
+
+    std::pair<Priority, Key> pop() {
+        std::pair<Priority, Key> top = *set_.begin();
+        set_.erase(set_.begin());
+        return top;
+    }
+
+private:
+    std::set<std::pair<Priority, Key>> set_;
+};
+
+} // namespace graph
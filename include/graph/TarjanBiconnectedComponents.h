@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename ComponentNumbers>
+class TarjanBiconnectedComponents {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    TarjanBiconnectedComponents(Graph &g, ComponentNumbers componentNumbers)
+        : g_(g), componentNumbers_(std::move(componentNumbers)) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        std::vector<size_t> dfn(n, kNpos);
+        std::vector<size_t> low(n);
+        std::vector<size_t> blocks(n, kNpos);
+        std::vector<Frame> frames;
+        std::vector<size_t> S;
+        size_t timer = 0;
+        size_t componentCount = 0;
+
+        for (size_t r = 0; r < n; ++r) {
+            if (dfn[r] != kNpos) {
+                continue;
+            }
+            dfn[r] = low[r] = timer++;
+            frames.push_back({r, kNpos, G.outBegin(r), false});
+            while (!frames.empty()) {
+                Frame &f = frames.back();
+                size_t v = f.v;
+                if (f.next < G.outEnd(v)) {
+                    size_t w = G.target(f.next++);
+                    if (w == v) {
+                        continue;
+                    }
+                    if (w == f.parent && !f.skipped) {
+                        f.skipped = true;
+                        continue;
+                    }
+                    if (dfn[w] == kNpos) {
+                        dfn[w] = low[w] = timer++;
+                        S.push_back(w);
+                        frames.push_back({w, v, G.outBegin(w), false});
+                    } else {
+                        low[v] = std::min(low[v], dfn[w]);
+                    }
+                    continue;
+                }
+                size_t p = f.parent;
+                frames.pop_back();
+                if (p == kNpos) {
+                    continue;
+                }
+                low[p] = std::min(low[p], low[v]);
+                if (low[v] >= dfn[p]) {
+                    size_t w;
+                    do {
+                        w = S.back();
+                        S.pop_back();
+                        blocks[w] = componentCount;
+                    } while (w != v);
+                    ++componentCount;
+                }
+            }
+        }
+
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            size_t u = G.source(e);
+            size_t v = G.target(e);
+            if (u == v) {
+                put(componentNumbers_, G.edge(e), kNpos);
+            } else {
+                put(componentNumbers_, G.edge(e), blocks[dfn[u] > dfn[v] ? u : v]);
+            }
+        }
+        return componentCount;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    struct Frame {
+        size_t v;
+        size_t parent;
+        size_t next;
+        bool skipped;
+    };
+
+    Graph &g_;
+    ComponentNumbers componentNumbers_;
+};
+
+} // namespace graph
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/atomic.h"
+#include "graph/detail/ConcurrentDisjointSets.h"
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename ComponentNumbers>
+class TarjanVishkinBiconnectedComponents {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    TarjanVishkinBiconnectedComponents(Graph &g, ComponentNumbers componentNumbers)
+        : g_(g), componentNumbers_(std::move(componentNumbers)) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        size_t n = G.numVertices();
+        Forest F = spanningForest(G);
+
+        std::vector<size_t> sizes(n, 1);
+        for (size_t l = F.levels.size() - 1; l > 0; --l) {
+            detail::parallelFor(F.levels[l - 1], F.levels[l], [&](size_t i) {
+                size_t v = F.order[i];
+                if (F.parents[v] != kNpos) {
+                    std::atomic_ref<size_t>(sizes[F.parents[v]]).fetch_add(sizes[v], std::memory_order_relaxed);
+                }
+            });
+        }
+
+        std::vector<size_t> childOffsets(n + 1);
+        for (size_t v = 0; v < n; ++v) {
+            if (F.parents[v] != kNpos) {
+                ++childOffsets[F.parents[v] + 1];
+            }
+        }
+        for (size_t v = 0; v < n; ++v) {
+            childOffsets[v + 1] += childOffsets[v];
+        }
+        std::vector<size_t> children(childOffsets[n]);
+        std::vector<size_t> next(childOffsets.begin(), childOffsets.end() - 1);
+        for (size_t v = 0; v < n; ++v) {
+            if (F.parents[v] != kNpos) {
+                children[next[F.parents[v]]++] = v;
+            }
+        }
+
+        std::vector<size_t> pre(n);
+        size_t base = 0;
+        for (size_t r : F.roots) {
+            pre[r] = base;
+            base += sizes[r];
+        }
+        for (size_t l = 0; l + 1 < F.levels.size(); ++l) {
+            detail::parallelFor(F.levels[l], F.levels[l + 1], [&](size_t i) {
+                size_t v = F.order[i];
+                size_t p = pre[v] + 1;
+                for (size_t j = childOffsets[v]; j < childOffsets[v + 1]; ++j) {
+                    pre[children[j]] = p;
+                    p += sizes[children[j]];
+                }
+            });
+        }
+
+        auto forEachNonTreeNeighbor = [&](size_t v, auto &&f) {
+            bool skipped = false;
+            for (size_t e = G.outBegin(v); e < G.outEnd(v); ++e) {
+                size_t w = G.target(e);
+                if (w == v || F.parentEdges[w] == e) {
+                    continue;
+                }
+                if (w == F.parents[v] && !skipped) {
+                    skipped = true;
+                    continue;
+                }
+                f(w);
+            }
+        };
+
+        std::vector<size_t> low(n);
+        std::vector<size_t> high(n);
+        detail::parallelFor(0, n, [&](size_t v) {
+            low[v] = high[v] = pre[v];
+            forEachNonTreeNeighbor(v, [&](size_t w) {
+                low[v] = std::min(low[v], pre[w]);
+                high[v] = std::max(high[v], pre[w]);
+            });
+        });
+        for (size_t l = F.levels.size() - 1; l > 0; --l) {
+            detail::parallelFor(F.levels[l - 1], F.levels[l], [&](size_t i) {
+                size_t v = F.order[i];
+                if (F.parents[v] != kNpos) {
+                    detail::fetchMin(low[F.parents[v]], low[v]);
+                    detail::fetchMax(high[F.parents[v]], high[v]);
+                }
+            });
+        }
+
+        detail::ConcurrentDisjointSets D(n);
+        detail::parallelFor(0, n, [&](size_t v) {
+            size_t p = F.parents[v];
+            if (p == kNpos) {
+                return;
+            }
+            if (F.parents[p] != kNpos && (low[v] < pre[p] || high[v] >= pre[p] + sizes[p])) {
+                D.union_(v, p);
+            }
+            forEachNonTreeNeighbor(v, [&](size_t w) {
+                if (pre[w] < pre[v] && pre[v] >= pre[w] + sizes[w]) {
+                    D.union_(v, w);
+                }
+            });
+        });
+
+        std::vector<size_t> blocks(n, kNpos);
+        size_t componentCount = 0;
+        for (size_t v = 0; v < n; ++v) {
+            if (F.parents[v] != kNpos && D.find(v) == v) {
+                blocks[v] = componentCount++;
+            }
+        }
+        detail::parallelFor(0, n, [&](size_t v) {
+            if (F.parents[v] != kNpos) {
+                blocks[v] = blocks[D.find(v)];
+            }
+        });
+
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            size_t u = G.source(e);
+            size_t v = G.target(e);
+            if (u == v) {
+                put(componentNumbers_, G.edge(e), kNpos);
+            } else {
+                put(componentNumbers_, G.edge(e), blocks[pre[u] > pre[v] ? u : v]);
+            }
+        }
+        return componentCount;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    struct Forest {
+        std::vector<size_t> parents;
+        std::vector<size_t> parentEdges;
+        std::vector<size_t> roots;
+        std::vector<size_t> order;
+        std::vector<size_t> levels;
+    };
+
+    Graph &g_;
+    ComponentNumbers componentNumbers_;
+
+    static Forest spanningForest(const detail::IndexedGraph<Graph> &G) {
+        size_t n = G.numVertices();
+        Forest F{std::vector<size_t>(n, kNpos), std::vector<size_t>(n, kNpos), {}, {}, {}};
+        std::vector<uint8_t> visited(n);
+        std::vector<std::vector<size_t>> levels;
+        std::vector<std::vector<size_t>> next(detail::threadCount());
+        for (size_t r = 0; r < n; ++r) {
+            if (visited[r]) {
+                continue;
+            }
+            visited[r] = true;
+            F.roots.push_back(r);
+            std::vector<size_t> frontier{r};
+            size_t depth = 0;
+            while (!frontier.empty()) {
+                if (depth == levels.size()) {
+                    levels.emplace_back();
+                }
+                levels[depth].insert(levels[depth].end(), frontier.begin(), frontier.end());
+                detail::parallelFor(0, frontier.size(), [&](size_t thread, size_t i) {
+                    size_t u = frontier[i];
+                    for (size_t e = G.outBegin(u); e < G.outEnd(u); ++e) {
+                        size_t w = G.target(e);
+                        uint8_t expected = false;
+                        if (!detail::atomicLoad(visited[w]) &&
+                            std::atomic_ref<uint8_t>(visited[w]).compare_exchange_strong(
+                                expected, true, std::memory_order_relaxed)) {
+                            F.parents[w] = u;
+                            F.parentEdges[w] = e;
+                            next[thread].push_back(w);
+                        }
+                    }
+                }, 64);
+                frontier.clear();
+                for (std::vector<size_t> &local : next) {
+                    frontier.insert(frontier.end(), local.begin(), local.end());
+                    local.clear();
+                }
+                ++depth;
+            }
+        }
+        F.levels.push_back(0);
+        for (const std::vector<size_t> &level : levels) {
+            F.order.insert(F.order.end(), level.begin(), level.end());
+            F.levels.push_back(F.order.size());
+        }
+        return F;
+    }
+};
+
+} // namespace graph
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/TriangleCounts.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Triangles>
+class TriangleCounting {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+public:
+    TriangleCounting(Graph &g, Triangles triangles) : g_(g), triangles_(std::move(triangles)) {}
+
+    size_t operator()() {
+        detail::IndexedGraph<Graph> G(g_);
+        detail::TriangleCounts T(G);
+        for (size_t v = 0; v < G.numVertices(); ++v) {
+            put(triangles_, G.vertex(v), T.triangles(v));
+        }
+        return T.total();
+    }
+
+private:
+    Graph &g_;
+    Triangles triangles_;
+};
+
+} // namespace graph
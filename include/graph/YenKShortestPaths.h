@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/SearchSpace.h"
+#include "graph/GeneralizedMaps.h"
+
+namespace graph {
+
+template <typename Graph, typename Weights>
+class YenKShortestPaths {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+    using Weight = GeneralizedMapTraits<Weights>::Value;
+
+public:
+    YenKShortestPaths(Graph &g, Weights weights)
+        : g_(g),
+          weights_(g_.edgeValues(weights)),
+          toTarget_(g_.numVertices()),
+          spur_(g_.numVertices()),
+          blockedVertices_(g_.numVertices()),
+          blockedEdges_(g_.numEdges()) {
+        g_.buildInEdges();
+    }
+
+    std::vector<std::pair<Weight, std::vector<Edge>>> operator()(Vertex s, Vertex t, size_t k) {
+        std::vector<std::pair<Weight, std::vector<Edge>>> result;
+        if (k == 0) {
+            return result;
+        }
+        size_t si = g_.index(s);
+        size_t ti = g_.index(t);
+        if (si == ti) {
+            result.push_back({0, {}});
+            return result;
+        }
+        searchToTarget(ti);
+        if (!toTarget_.reached(si)) {
+            return result;
+        }
+
+        std::vector<Path> paths;
+        std::map<std::pair<Weight, std::vector<size_t>>, size_t> candidates;
+        paths.push_back({toTarget_.dist(si), treePath(si), 0});
+        while (paths.size() < k) {
+            const Path &last = paths.back();
+            std::vector<Weight> rootDists(last.edges.size() + 1);
+            for (size_t i = 0; i < last.edges.size(); ++i) {
+                rootDists[i + 1] = rootDists[i] + weights_[last.edges[i]];
+            }
+            for (size_t i = last.deviation; i < last.edges.size(); ++i) {
+                size_t spur = g_.source(last.edges[i]);
+                block();
+                for (const Path &p : paths) {
+                    if (p.edges.size() > i && std::equal(p.edges.begin(), p.edges.begin() + i, last.edges.begin())) {
+                        blockedEdges_[p.edges[i]] = epoch_;
+                    }
+                }
+                for (size_t j = 0; j < i; ++j) {
+                    blockedVertices_[g_.source(last.edges[j])] = epoch_;
+                }
+                std::vector<size_t> edges(last.edges.begin(), last.edges.begin() + i);
+                std::optional<Weight> d = searchSpur(spur, ti, edges);
+                if (d.has_value()) {
+                    candidates.try_emplace({rootDists[i] + *d, std::move(edges)}, i);
+                }
+            }
+            if (candidates.empty()) {
+                break;
+            }
+            auto node = candidates.extract(candidates.begin());
+            paths.push_back({node.key().first, std::move(node.key().second), node.mapped()});
+        }
+
+        result.reserve(paths.size());
+        for (Path &p : paths) {
+            std::vector<Edge> edges;
+            edges.reserve(p.edges.size());
+            for (size_t e : p.edges) {
+                edges.push_back(g_.edge(e));
+            }
+            result.push_back({p.dist, std::move(edges)});
+        }
+        return result;
+    }
+
+private:
+    static constexpr size_t kNpos = -1;
+
+    struct Path {
+        Weight dist;
+        std::vector<size_t> edges;
+        size_t deviation;
+    };
+
+    detail::IndexedGraph<Graph> g_;
+    std::vector<Weight> weights_;
+    detail::SearchSpace<Weight> toTarget_;
+    detail::SearchSpace<Weight> spur_;
+    std::vector<uint32_t> blockedVertices_;
+    std::vector<uint32_t> blockedEdges_;
+    uint32_t epoch_{0};
+
+    void block() {
+        if (++epoch_ == 0) {
+            std::ranges::fill(blockedVertices_, 0);
+            std::ranges::fill(blockedEdges_, 0);
+            epoch_ = 1;
+        }
+    }
+
+    bool blocked(size_t e) const {
+        return blockedEdges_[e] == epoch_ || blockedVertices_[g_.target(e)] == epoch_;
+    }
+
+    void searchToTarget(size_t ti) {
+        toTarget_.clear();
+        toTarget_.relax(ti, 0, kNpos);
+        while (!toTarget_.empty()) {
+            size_t u = toTarget_.pop();
+            for (size_t i = g_.inBegin(u); i < g_.inEnd(u); ++i) {
+                size_t e = g_.inEdge(i);
+                toTarget_.relax(g_.source(e), toTarget_.dist(u) + weights_[e], e);
+            }
+        }
+    }
+
+    std::vector<size_t> treePath(size_t v) const {
+        std::vector<size_t> edges;
+        for (; toTarget_.pred(v) != kNpos; v = g_.target(toTarget_.pred(v))) {
+            edges.push_back(toTarget_.pred(v));
+        }
+        return edges;
+    }
+
+    std::optional<Weight> searchSpur(size_t spur, size_t ti, std::vector<size_t> &edges) {
+        bool clear = true;
+        for (size_t v = spur; v != ti; v = g_.target(toTarget_.pred(v))) {
+            if (blocked(toTarget_.pred(v))) {
+                clear = false;
+                break;
+            }
+        }
+        if (clear) {
+            std::vector<size_t> tail = treePath(spur);
+            edges.insert(edges.end(), tail.begin(), tail.end());
+            return toTarget_.dist(spur);
+        }
+
+        spur_.clear();
+        spur_.relax(spur, toTarget_.dist(spur), kNpos);
+        while (!spur_.empty()) {
+            size_t u = spur_.pop();
+            if (u == ti) {
+                break;
+            }
+            Weight d = spur_.dist(u) - toTarget_.dist(u);
+            for (size_t e = g_.outBegin(u); e < g_.outEnd(u); ++e) {
+                size_t v = g_.target(e);
+                if (blocked(e) || !toTarget_.reached(v)) {
+                    continue;
+                }
+                spur_.relax(v, d + weights_[e] + toTarget_.dist(v), e);
+            }
+        }
+        if (!spur_.settled(ti)) {
+            return std::nullopt;
+        }
+        size_t begin = edges.size();
+        for (size_t v = ti; v != spur; v = g_.source(spur_.pred(v))) {
+            edges.push_back(spur_.pred(v));
+        }
+        std::reverse(edges.begin() + begin, edges.end());
+        return spur_.dist(ti);
+    }
+};
+
+} // namespace graph
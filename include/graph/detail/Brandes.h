@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+#include "graph/Infinity.h"
+#include "graph/LazyBinaryHeap.h"
+
+namespace graph::detail {
+
+template <typename Graph, typename Value, typename Weight>
+class Brandes {
+public:
+    Brandes(const IndexedGraph<Graph> &G, const std::vector<Weight> *weights, bool withEdges)
+        : G_(G),
+          weights_(weights),
+          withEdges_(withEdges),
+          vertexScores_(G.numVertices()),
+          edgeScores_(withEdges ? G.numEdges() : 0) {}
+
+    const std::vector<Value> &vertexScores() const {
+        return vertexScores_;
+    }
+
+    const std::vector<Value> &edgeScores() const {
+        return edgeScores_;
+    }
+
+    void exact() {
+        std::vector<size_t> sources(G_.numVertices());
+        for (size_t s = 0; s < sources.size(); ++s) {
+            sources[s] = s;
+        }
+        accumulate(sources, 1);
+    }
+
+    Value sample(size_t sampleCount, Value delta, unsigned seed) {
+        size_t n = G_.numVertices();
+        if (n == 0 || sampleCount == 0) {
+            return 0;
+        }
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<size_t> dist(0, n - 1);
+        std::vector<size_t> sources(sampleCount);
+        for (size_t &s : sources) {
+            s = dist(rng);
+        }
+        accumulate(sources, static_cast<Value>(n) / static_cast<Value>(sampleCount));
+        if (n < 3) {
+            return 0;
+        }
+        return static_cast<Value>(n) * static_cast<Value>(n - 2) *
+               std::sqrt(std::log(2 * static_cast<Value>(n) / delta) / (2 * static_cast<Value>(sampleCount)));
+    }
+
+private:
+    struct Scratch {
+        std::vector<Weight> dists;
+        std::vector<Value> sigmas;
+        std::vector<Value> deltas;
+        std::vector<size_t> order;
+        std::vector<Value> vertexScores;
+        std::vector<Value> edgeScores;
+    };
+
+    const IndexedGraph<Graph> &G_;
+    const std::vector<Weight> *weights_;
+    bool withEdges_;
+    std::vector<Value> vertexScores_;
+    std::vector<Value> edgeScores_;
+
+    void accumulate(const std::vector<size_t> &sources, Value scale) {
+        size_t n = G_.numVertices();
+        std::vector<Scratch> scratches(threadCount());
+        parallelFor(0, sources.size(), [&](size_t thread, size_t i) {
+            Scratch &S = scratches[thread];
+            if (S.dists.empty()) {
+                S.dists.assign(n, kInfinity<Weight>);
+                S.sigmas.assign(n, 0);
+                S.deltas.assign(n, 0);
+                S.vertexScores.assign(n, 0);
+                S.edgeScores.assign(withEdges_ ? G_.numEdges() : 0, 0);
+            }
+            size_t s = sources[i];
+            if (weights_ == nullptr) {
+                search(S, s);
+            } else {
+                dijkstra(S, s);
+            }
+            for (size_t j = S.order.size(); j-- > 0;) {
+                size_t v = S.order[j];
+                for (size_t e = G_.outBegin(v); e < G_.outEnd(v); ++e) {
+                    size_t w = G_.target(e);
+                    if (S.dists[w] != kInfinity<Weight> && S.dists[w] == S.dists[v] + length(e) && w != v) {
+                        Value c = S.sigmas[v] / S.sigmas[w] * (1 + S.deltas[w]);
+                        S.deltas[v] += c;
+                        if (withEdges_) {
+                            S.edgeScores[e] += scale * c;
+                        }
+                    }
+                }
+                if (v != s) {
+                    S.vertexScores[v] += scale * S.deltas[v];
+                }
+            }
+            for (size_t v : S.order) {
+                S.dists[v] = kInfinity<Weight>;
+                S.sigmas[v] = 0;
+                S.deltas[v] = 0;
+            }
+            S.order.clear();
+        }, 1);
+        for (Scratch &S : scratches) {
+            for (size_t v = 0; v < S.vertexScores.size(); ++v) {
+                vertexScores_[v] += S.vertexScores[v];
+            }
+            for (size_t e = 0; e < S.edgeScores.size(); ++e) {
+                edgeScores_[e] += S.edgeScores[e];
+            }
+        }
+    }
+
+    Weight length(size_t e) const {
+        return weights_ == nullptr ? 1 : (*weights_)[e];
+    }
+
+    void search(Scratch &S, size_t s) const {
+        S.dists[s] = 0;
+        S.sigmas[s] = 1;
+        S.order.push_back(s);
+        for (size_t head = 0; head < S.order.size(); ++head) {
+            size_t v = S.order[head];
+            for (size_t e = G_.outBegin(v); e < G_.outEnd(v); ++e) {
+                size_t w = G_.target(e);
+                if (S.dists[w] == kInfinity<Weight>) {
+                    S.dists[w] = S.dists[v] + 1;
+                    S.order.push_back(w);
+                }
+                if (S.dists[w] == S.dists[v] + 1) {
+                    S.sigmas[w] += S.sigmas[v];
+                }
+            }
+        }
+    }
+
+    void dijkstra(Scratch &S, size_t s) const {
+        LazyBinaryHeap<size_t, Weight> Q;
+        S.dists[s] = 0;
+        S.sigmas[s] = 1;
+        Q.push(s, 0);
+        while (!Q.empty()) {
+            auto [d, v] = Q.pop();
+            if (d > S.dists[v]) {
+                continue;
+            }
+            S.order.push_back(v);
+            for (size_t e = G_.outBegin(v); e < G_.outEnd(v); ++e) {
+                size_t w = G_.target(e);
+                Weight nd = d + length(e);
+                if (nd < S.dists[w]) {
+                    S.dists[w] = nd;
+                    S.sigmas[w] = S.sigmas[v];
+                    Q.push(w, nd);
+                } else if (nd == S.dists[w] && w != v) {
+                    S.sigmas[w] += S.sigmas[v];
+                }
+            }
+        }
+    }
+};
+
+} // namespace graph::detail
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace graph::detail {
+
+class ConcurrentDisjointSets {
+public:
+    static constexpr size_t kNpos = -1;
+
+    explicit ConcurrentDisjointSets(size_t n) : parents_(n) {
+        std::iota(parents_.begin(), parents_.end(), 0);
+    }
+
+    explicit ConcurrentDisjointSets(std::vector<size_t> parents) : parents_(std::move(parents)) {}
+
+    size_t size() const {
+        return parents_.size();
+    }
+
+    size_t makeSet() {
+        parents_.push_back(parents_.size());
+        return parents_.size() - 1;
+    }
+
+    const std::vector<size_t> &parents() const {
+        return parents_;
+    }
+
+    size_t find(size_t x) {
+        while (true) {
+            size_t p = parent(x).load(std::memory_order_relaxed);
+            if (p == x) {
+                return x;
+            }
+            size_t gp = parent(p).load(std::memory_order_relaxed);
+            if (p != gp) {
+                parent(x).compare_exchange_weak(p, gp, std::memory_order_relaxed);
+            }
+            x = gp;
+        }
+    }
+
+    bool sameSet(size_t x, size_t y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return true;
+            }
+            if (parent(x).load(std::memory_order_relaxed) == x) {
+                return false;
+            }
+        }
+    }
+
+    bool union_(size_t x, size_t y) {
+        return link(x, y) != kNpos;
+    }
+
+    size_t link(size_t x, size_t y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return kNpos;
+            }
+            if (x < y) {
+                std::swap(x, y);
+            }
+            size_t expected = x;
+            if (parent(x).compare_exchange_strong(expected, y, std::memory_order_relaxed)) {
+                return x;
+            }
+        }
+    }
+
+private:
+    std::vector<size_t> parents_;
+
+    std::atomic_ref<size_t> parent(size_t x) {
+        return std::atomic_ref<size_t>(parents_[x]);
+    }
+};
+
+} // namespace graph::detail
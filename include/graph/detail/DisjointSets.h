@@ -1,50 +1,53 @@
 #pragma once
 
 #include <cstddef>
-#include <unordered_map>
+#include <numeric>
 #include <utility>
-
-#include "graph/GeneralizedMaps.h"
+#include <vector>
 
 namespace graph::detail {
 
-template <typename Key,
-          typename Parents = std::unordered_map<Key, Key>,
-          typename Ranks = std::unordered_map<Key, size_t>>
 class DisjointSets {
 public:
-    void makeSet(Key x) {
-        put(parents_, x, x);
-        put(ranks_, x, 0);
+    explicit DisjointSets(size_t n) : parents_(n), sizes_(n, 1) {
+        std::iota(parents_.begin(), parents_.end(), 0);
+    }
+
+    size_t size() const {
+        return parents_.size();
     }
 
-    Key find(Key x) {
-        if (get(parents_, x) == x) {
-            return x;
+    size_t find(size_t x) {
+        while (parents_[x] != x) {
+            parents_[x] = parents_[parents_[x]];
+            x = parents_[x];
         }
-        put(parents_, x, find(get(parents_, x)));
-        return get(parents_, x);
+        return x;
     }
 
-    void union_(Key x, Key y) {
+    size_t setSize(size_t x) {
+        return sizes_[find(x)];
+    }
+
+    bool union_(size_t x, size_t y) {
         using std::swap;
 
         x = find(x);
         y = find(y);
-        if (x != y) {
-            if (get(ranks_, x) > get(ranks_, y)) {
-                swap(x, y);
-            }
-            put(parents_, x, y);
-            if (get(ranks_, x) == get(ranks_, y)) {
-                put(ranks_, y, get(ranks_, x) + 1);
-            }
+        if (x == y) {
+            return false;
+        }
+        if (sizes_[x] > sizes_[y]) {
+            swap(x, y);
         }
+        parents_[x] = y;
+        sizes_[y] += sizes_[x];
+        return true;
     }
 
 private:
-    mutable Parents parents_;
-    mutable Ranks ranks_;
+    std::vector<size_t> parents_;
+    std::vector<size_t> sizes_;
 };
 
-} // namespace graph
+} // namespace graph::detail
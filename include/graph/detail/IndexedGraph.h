@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/GeneralizedMaps.h"
+
+namespace graph::detail {
+
+template <typename Graph>
+class IndexedGraph {
+    using Vertex = Graph::Vertex;
+    using Edge = Graph::Edge;
+
+    template <typename V>
+    using VertexMap = Graph::template VertexMap<V>;
+
+public:
+    static constexpr size_t kNpos = -1;
+
+    explicit IndexedGraph(Graph &g) {
+        for (Vertex v : g.vertices()) {
+            put(indices_, v, vertices_.size());
+            vertices_.push_back(v);
+        }
+        outOffsets_.reserve(vertices_.size() + 1);
+        outOffsets_.push_back(0);
+        for (size_t u = 0; u < vertices_.size(); ++u) {
+            for (Edge e : g.outEdges(vertices_[u])) {
+                sources_.push_back(u);
+                targets_.push_back(get(indices_, g.target(e)));
+                edges_.push_back(e);
+            }
+            outOffsets_.push_back(edges_.size());
+        }
+    }
+
+    size_t numVertices() const {
+        return vertices_.size();
+    }
+
+    size_t numEdges() const {
+        return edges_.size();
+    }
+
+    Vertex vertex(size_t v) const {
+        return vertices_[v];
+    }
+
+    size_t index(Vertex v) const {
+        return get(indices_, v);
+    }
+
+    Edge edge(size_t e) const {
+        return edges_[e];
+    }
+
+    size_t source(size_t e) const {
+        return sources_[e];
+    }
+
+    size_t target(size_t e) const {
+        return targets_[e];
+    }
+
+    size_t outBegin(size_t u) const {
+        return outOffsets_[u];
+    }
+
+    size_t outEnd(size_t u) const {
+        return outOffsets_[u + 1];
+    }
+
+    size_t outDegree(size_t u) const {
+        return outOffsets_[u + 1] - outOffsets_[u];
+    }
+
+    void buildInEdges() {
+        if (!inOffsets_.empty()) {
+            return;
+        }
+        inOffsets_.assign(vertices_.size() + 1, 0);
+        for (size_t e = 0; e < edges_.size(); ++e) {
+            ++inOffsets_[targets_[e] + 1];
+        }
+        for (size_t v = 0; v < vertices_.size(); ++v) {
+            inOffsets_[v + 1] += inOffsets_[v];
+        }
+        inEdges_.resize(edges_.size());
+        std::vector<size_t> next(inOffsets_.begin(), inOffsets_.end() - 1);
+        for (size_t e = 0; e < edges_.size(); ++e) {
+            inEdges_[next[targets_[e]]++] = e;
+        }
+    }
+
+    size_t inBegin(size_t v) const {
+        return inOffsets_[v];
+    }
+
+    size_t inEnd(size_t v) const {
+        return inOffsets_[v + 1];
+    }
+
+    size_t inDegree(size_t v) const {
+        return inOffsets_[v + 1] - inOffsets_[v];
+    }
+
+    size_t inEdge(size_t i) const {
+        return inEdges_[i];
+    }
+
+    template <typename Map>
+    std::vector<typename GeneralizedMapTraits<Map>::Value> edgeValues(const Map &map) const {
+        std::vector<typename GeneralizedMapTraits<Map>::Value> values;
+        values.reserve(edges_.size());
+        for (Edge e : edges_) {
+            values.push_back(get(map, e));
+        }
+        return values;
+    }
+
+private:
+    std::vector<Vertex> vertices_;
+    VertexMap<size_t> indices_;
+    std::vector<size_t> outOffsets_;
+    std::vector<size_t> sources_;
+    std::vector<size_t> targets_;
+    std::vector<Edge> edges_;
+    std::vector<size_t> inOffsets_;
+    std::vector<size_t> inEdges_;
+};
+
+} // namespace graph::detail
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <type_traits>
+
+namespace graph::detail {
+
+template <typename>
+struct is_monotone_priority_queue_impl : std::false_type {};
+
+template <typename T>
+struct is_monotone_priority_queue : is_monotone_priority_queue_impl<std::remove_cv_t<T>> {};
+
+template <typename T>
+inline constexpr bool is_monotone_priority_queue_v = is_monotone_priority_queue<T>::value;
+
+template <typename T>
+concept MonotonePriorityQueue = is_monotone_priority_queue_v<T>;
+
+} // namespace graph::detail
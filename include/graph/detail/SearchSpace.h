@@ -0,0 +1,87 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "graph/DaryHeap.h"
+
+namespace graph::detail {
+
+template <typename Weight>
+class SearchSpace {
+public:
+    static constexpr size_t kNpos = -1;
+
+    explicit SearchSpace(size_t n)
+        : dists_(n), preds_(n), reached_(n), settled_(n), queue_(std::vector<size_t>(n)) {}
+
+    void clear() {
+        queue_.clear();
+        if (++epoch_ == 0) {
+            std::ranges::fill(reached_, 0);
+            std::ranges::fill(settled_, 0);
+            epoch_ = 1;
+        }
+    }
+
+    bool reached(size_t v) const {
+        return reached_[v] == epoch_;
+    }
+
+    bool settled(size_t v) const {
+        return settled_[v] == epoch_;
+    }
+
+    Weight dist(size_t v) const {
+        return dists_[v];
+    }
+
+    size_t pred(size_t v) const {
+        return preds_[v];
+    }
+
+    bool relax(size_t v, Weight d, size_t pred) {
+        if (!reached(v)) {
+            reached_[v] = epoch_;
+            dists_[v] = d;
+            preds_[v] = pred;
+            queue_.push(v, d);
+            return true;
+        }
+        if (d < dists_[v]) {
+            Weight old = dists_[v];
+            dists_[v] = d;
+            preds_[v] = pred;
+            queue_.decrease(v, old, d);
+            return true;
+        }
+        return false;
+    }
+
+    bool empty() const {
+        return queue_.empty();
+    }
+
+    Weight topKey() const {
+        return queue_.top().first;
+    }
+
+    size_t pop() {
+        size_t v = queue_.pop().second;
+        settled_[v] = epoch_;
+        return v;
+    }
+
+private:
+    std::vector<Weight> dists_;
+    std::vector<size_t> preds_;
+    std::vector<uint32_t> reached_;
+    std::vector<uint32_t> settled_;
+    uint32_t epoch_{1};
+    DaryHeap<size_t, Weight, 4, std::vector<size_t>> queue_;
+};
+
+} // namespace graph::detail
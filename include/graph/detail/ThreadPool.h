@@ -0,0 +1,144 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace graph::detail {
+
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t size) {
+        for (size_t i = 1; i < size; ++i) {
+            workers_.emplace_back([this, i] { work(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (std::thread &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    size_t size() const {
+        return workers_.size() + 1;
+    }
+
+    template <typename F>
+    void run(F &&f) {
+        if (inside() || workers_.empty()) {
+            for (size_t i = 0; i < size(); ++i) {
+                f(i);
+            }
+            return;
+        }
+        std::lock_guard runLock(runMutex_);
+        {
+            std::lock_guard lock(mutex_);
+            task_ = std::ref(f);
+            pending_ = workers_.size();
+            ++generation_;
+        }
+        start_.notify_all();
+        inside() = true;
+        f(0);
+        inside() = false;
+        std::unique_lock lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+    }
+
+    static ThreadPool &instance() {
+        static ThreadPool pool(std::max<size_t>(std::thread::hardware_concurrency(), 1));
+        return pool;
+    }
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex runMutex_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::function<void(size_t)> task_;
+    size_t generation_{};
+    size_t pending_{};
+    bool stop_{};
+
+    static bool &inside() {
+        thread_local bool inside = false;
+        return inside;
+    }
+
+    void work(size_t i) {
+        inside() = true;
+        size_t generation = 0;
+        while (true) {
+            std::function<void(size_t)> task;
+            {
+                std::unique_lock lock(mutex_);
+                start_.wait(lock, [&] { return stop_ || generation_ != generation; });
+                if (stop_) {
+                    return;
+                }
+                generation = generation_;
+                task = task_;
+            }
+            task(i);
+            {
+                std::lock_guard lock(mutex_);
+                --pending_;
+            }
+            done_.notify_one();
+        }
+    }
+};
+
+inline size_t threadCount() {
+    return ThreadPool::instance().size();
+}
+
+template <typename F>
+void parallelFor(size_t begin, size_t end, F &&f, size_t grain = 256) {
+    if (begin >= end) {
+        return;
+    }
+    std::atomic<size_t> next = begin;
+    auto body = [&](size_t thread) {
+        while (true) {
+            size_t lo = next.fetch_add(grain, std::memory_order_relaxed);
+            if (lo >= end) {
+                break;
+            }
+            size_t hi = std::min(lo + grain, end);
+            for (size_t i = lo; i < hi; ++i) {
+                if constexpr (std::is_invocable_v<F &, size_t, size_t>) {
+                    f(thread, i);
+                } else {
+                    f(i);
+                }
+            }
+        }
+    };
+    if (end - begin <= grain) {
+        body(0);
+    } else {
+        ThreadPool::instance().run(body);
+    }
+}
+
+} // namespace graph::detail
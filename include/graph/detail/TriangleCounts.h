@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "graph/detail/IndexedGraph.h"
+#include "graph/detail/ThreadPool.h"
+
+namespace graph::detail {
+
+class TriangleCounts {
+public:
+    template <typename Graph>
+    explicit TriangleCounts(const IndexedGraph<Graph> &G) {
+        size_t n = G.numVertices();
+
+        std::vector<size_t> offsets(n + 1);
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            if (G.source(e) != G.target(e)) {
+                ++offsets[G.source(e) + 1];
+                ++offsets[G.target(e) + 1];
+            }
+        }
+        for (size_t v = 0; v < n; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<size_t> neighbors(offsets[n]);
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (size_t e = 0; e < G.numEdges(); ++e) {
+            size_t u = G.source(e);
+            size_t v = G.target(e);
+            if (u != v) {
+                neighbors[next[u]++] = v;
+                neighbors[next[v]++] = u;
+            }
+        }
+        degrees_.assign(n, 0);
+        parallelFor(0, n, [&](size_t v) {
+            auto first = neighbors.begin() + static_cast<std::ptrdiff_t>(offsets[v]);
+            auto last = neighbors.begin() + static_cast<std::ptrdiff_t>(offsets[v + 1]);
+            std::sort(first, last);
+            degrees_[v] = static_cast<size_t>(std::unique(first, last) - first);
+        });
+
+        std::vector<size_t> order(n);
+        for (size_t v = 0; v < n; ++v) {
+            order[v] = v;
+        }
+        std::ranges::sort(order, [&](size_t lhs, size_t rhs) {
+            return degrees_[lhs] != degrees_[rhs] ? degrees_[lhs] < degrees_[rhs] : lhs < rhs;
+        });
+        std::vector<size_t> ranks(n);
+        for (size_t r = 0; r < n; ++r) {
+            ranks[order[r]] = r;
+        }
+
+        std::vector<size_t> outOffsets(n + 1);
+        for (size_t r = 0; r < n; ++r) {
+            size_t v = order[r];
+            size_t count = 0;
+            for (size_t i = offsets[v]; i < offsets[v] + degrees_[v]; ++i) {
+                count += ranks[neighbors[i]] > r;
+            }
+            outOffsets[r + 1] = outOffsets[r] + count;
+        }
+        std::vector<size_t> out(outOffsets[n]);
+        parallelFor(0, n, [&](size_t r) {
+            size_t v = order[r];
+            size_t k = outOffsets[r];
+            for (size_t i = offsets[v]; i < offsets[v] + degrees_[v]; ++i) {
+                if (ranks[neighbors[i]] > r) {
+                    out[k++] = ranks[neighbors[i]];
+                }
+            }
+            std::sort(out.begin() + static_cast<std::ptrdiff_t>(outOffsets[r]),
+                      out.begin() + static_cast<std::ptrdiff_t>(outOffsets[r + 1]));
+        });
+
+        std::vector<size_t> counts(n);
+        std::vector<std::vector<size_t>> buffers(threadCount());
+        std::atomic<size_t> total = 0;
+        parallelFor(0, n, [&](size_t thread, size_t u) {
+            std::vector<size_t> &hits = buffers[thread];
+            size_t local = 0;
+            for (size_t i = outOffsets[u]; i < outOffsets[u + 1]; ++i) {
+                size_t v = out[i];
+                hits.clear();
+                intersect(out.data() + i + 1, out.data() + outOffsets[u + 1],
+                          out.data() + outOffsets[v], out.data() + outOffsets[v + 1], hits);
+                if (hits.empty()) {
+                    continue;
+                }
+                local += hits.size();
+                std::atomic_ref<size_t>(counts[v]).fetch_add(hits.size(), std::memory_order_relaxed);
+                for (size_t w : hits) {
+                    std::atomic_ref<size_t>(counts[w]).fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (local != 0) {
+                std::atomic_ref<size_t>(counts[u]).fetch_add(local, std::memory_order_relaxed);
+                total.fetch_add(local, std::memory_order_relaxed);
+            }
+        }, 64);
+        triangles_.resize(n);
+        for (size_t v = 0; v < n; ++v) {
+            triangles_[v] = counts[ranks[v]];
+        }
+        total_ = total.load();
+    }
+
+    size_t total() const {
+        return total_;
+    }
+
+    size_t triangles(size_t v) const {
+        return triangles_[v];
+    }
+
+    size_t degree(size_t v) const {
+        return degrees_[v];
+    }
+
+private:
+    static constexpr size_t kGallopRatio = 32;
+
+    size_t total_ = 0;
+    std::vector<size_t> triangles_;
+    std::vector<size_t> degrees_;
+
+    static void intersect(const size_t *a, const size_t *aEnd, const size_t *b, const size_t *bEnd,
+                          std::vector<size_t> &hits) {
+        if (aEnd - a > bEnd - b) {
+            std::swap(a, b);
+            std::swap(aEnd, bEnd);
+        }
+        if (a == aEnd) {
+            return;
+        }
+        if (static_cast<size_t>(aEnd - a) * kGallopRatio < static_cast<size_t>(bEnd - b)) {
+            for (; a < aEnd && b < bEnd; ++a) {
+                b = gallop(b, bEnd, *a);
+                if (b < bEnd && *b == *a) {
+                    hits.push_back(*a);
+                }
+            }
+            return;
+        }
+        size_t offset = hits.size();
+        hits.resize(offset + static_cast<size_t>(aEnd - a));
+        size_t *h = hits.data() + offset;
+        while (a < aEnd && b < bEnd) {
+            size_t x = *a;
+            size_t y = *b;
+            *h = x;
+            h += x == y;
+            a += x <= y;
+            b += y <= x;
+        }
+        hits.resize(static_cast<size_t>(h - hits.data()));
+    }
+
+    static const size_t *gallop(const size_t *first, const size_t *last, size_t value) {
+        size_t step = 1;
+        while (first + step < last && first[step] < value) {
+            first += step;
+            step *= 2;
+        }
+        return std::lower_bound(first, std::min(first + step + 1, last), value);
+    }
+};
+
+} // namespace graph::detail
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+
+namespace graph::detail {
+
+template <typename T>
+bool fetchMin(T &target, T value) {
+    std::atomic_ref<T> ref(target);
+    T current = ref.load(std::memory_order_relaxed);
+    while (value < current) {
+        if (ref.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+bool fetchMax(T &target, T value) {
+    std::atomic_ref<T> ref(target);
+    T current = ref.load(std::memory_order_relaxed);
+    while (current < value) {
+        if (ref.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+T atomicLoad(T &target) {
+    return std::atomic_ref<T>(target).load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void atomicStore(T &target, T value) {
+    std::atomic_ref<T>(target).store(value, std::memory_order_relaxed);
+}
+
+} // namespace graph::detail
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace graph::detail {
+
+inline constexpr size_t kReadChunk = 1 << 16;
+
+template <typename T>
+void writeBinary(std::ostream &out, const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+void writeBinary(std::ostream &out, const std::vector<T> &values) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    writeBinary(out, static_cast<uint64_t>(values.size()));
+    out.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+void readBinary(std::istream &in, T &value) {
+    in.read(reinterpret_cast<char *>(&value), sizeof(T));
+}
+
+template <typename T>
+void readBinary(std::istream &in, std::vector<T> &values) {
+    uint64_t size = 0;
+    readBinary(in, size);
+    if (!in) {
+        return;
+    }
+    values.clear();
+    while (values.size() < size && in) {
+        size_t offset = values.size();
+        size_t count = std::min<uint64_t>(size - offset, kReadChunk);
+        values.resize(offset + count);
+        in.read(reinterpret_cast<char *>(values.data() + offset), count * sizeof(T));
+    }
+}
+
+} // namespace graph::detail